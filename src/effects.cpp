@@ -0,0 +1,191 @@
+#include "effects.h"
+#include <Arduino.h>
+#include <math.h>
+#include "log.h"
+
+// All render functions run on 8-bit fixed point (FastLED scale8/qsub8) and
+// lookup tables built once in setupEffects(); no floats on the frame path.
+
+#ifndef CHASE_PIXELS_PER_SEC
+#define CHASE_PIXELS_PER_SEC 12
+#endif
+
+#define CHASE_TAIL_SHIFT 3  // tail of 8 pixels
+
+typedef void (*RenderFn)(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t t,
+                         int8_t direction, EffectState& state);
+
+struct Effect {
+  const char* name;
+  RenderFn render;
+  uint16_t budgetNsPerPixel;
+  bool animated;  // output changes from frame to frame
+};
+
+static uint8_t sineLut[256];
+static uint8_t noiseLut[256];
+
+static EffectStats stats;
+
+static uint32_t nextRandom(uint32_t& state) {
+  // xorshift32; the state must never be 0.
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static uint32_t mixSeed(uint32_t seed) {
+  // Spreads similar efuse ids apart; 0 would lock xorshift at 0.
+  seed = (seed ^ (seed >> 16)) * 0x45D9F3Bu;
+  seed ^= seed >> 16;
+  return seed ? seed : 0x9E3779B9;
+}
+
+static void buildLuts(uint32_t seed) {
+  uint32_t prng = mixSeed(seed);
+  for (int i = 0; i < 256; i++) {
+    sineLut[i] = (uint8_t)lroundf(127.5f + 127.5f * sinf(i * 2.0f * (float)M_PI / 256.0f));
+  }
+
+  // Smoothstep-interpolated value noise with 16 control points, wrapping at 256.
+  uint8_t points[16];
+  for (uint8_t& p : points) {
+    p = nextRandom(prng) >> 24;
+  }
+  for (int i = 0; i < 256; i++) {
+    int a = points[i >> 4];
+    int b = points[((i >> 4) + 1) & 15];
+    uint32_t f = (i & 15) << 4;
+    uint32_t s = (f * f * (768 - 2 * f)) >> 16;
+    noiseLut[i] = (uint8_t)(a + (((b - a) * (int)s) >> 8));
+  }
+}
+
+static CRGB scaleColor(const CRGB& color, uint8_t level) {
+  return CRGB(scale8(color.r, level), scale8(color.g, level), scale8(color.b, level));
+}
+
+static void renderSolid(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t t,
+                        int8_t direction, EffectState& state) {
+  for (uint16_t i = 0; i < count; i++) {
+    pixels[i] = color;
+  }
+}
+
+static void renderFlicker(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t t,
+                          int8_t direction, EffectState& state) {
+  // Occasional draughts dim the whole flame and recover over ~20 frames.
+  if ((nextRandom(state.prng) & 0xFF) < 3) {
+    state.gust = 70;
+  } else {
+    state.gust = qsub8(state.gust, 4);
+  }
+  uint8_t gust = state.gust;
+
+  uint8_t slow = (uint8_t)((t >> 3) + state.phase);
+  uint8_t fast = (uint8_t)((t >> 1) + state.phase * 3);
+  for (uint16_t i = 0; i < count; i++) {
+    uint8_t n1 = noiseLut[(uint8_t)(slow + i * 37)];
+    uint8_t n2 = noiseLut[(uint8_t)(fast + i * 91)];
+    uint8_t level = qsub8(140 + scale8(n1, 80) + scale8(n2, 35), gust);
+    // Dimmer flame burns redder: green and blue drop with level squared.
+    uint8_t warm = scale8(level, level);
+    pixels[i] = CRGB(scale8(color.r, level), scale8(color.g, warm), scale8(color.b, warm));
+  }
+}
+
+static void renderBreathe(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t t,
+                          int8_t direction, EffectState& state) {
+  // One breath every 256 * 16 ms (~4 s), between ~40% and full level.
+  uint8_t level = 96 + scale8(sineLut[(uint8_t)(t >> 4)], 159);
+  CRGB scaled = scaleColor(color, level);
+  for (uint16_t i = 0; i < count; i++) {
+    pixels[i] = scaled;
+  }
+}
+
+static void renderChase(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t t,
+                        int8_t direction, EffectState& state) {
+  if (count == 0) return;
+  // Head position in 8.8 fixed point pixels.
+  uint32_t span = (uint32_t)count << 8;
+  uint32_t head = (uint32_t)(((uint64_t)t * CHASE_PIXELS_PER_SEC * 256 / 1000) % span);
+  uint32_t tail = 256u << CHASE_TAIL_SHIFT;
+  CRGB floor = scaleColor(color, 40);
+
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t index = (direction > 0) ? i : (uint16_t)(count - 1 - i);
+    uint32_t pos = (uint32_t)i << 8;
+    uint32_t behind = (head >= pos) ? head - pos : head + span - pos;
+    if (behind < tail) {
+      uint8_t level = 255 - (uint8_t)(behind >> CHASE_TAIL_SHIFT);
+      pixels[index] = scaleColor(color, level < 40 ? 40 : level);
+    } else {
+      pixels[index] = floor;
+    }
+  }
+}
+
+static const Effect kEffects[] = {
+  {"solid", renderSolid, 100, false},
+  {"flicker", renderFlicker, 600, true},
+  {"breathe", renderBreathe, 150, true},
+  {"chase", renderChase, 500, true},
+};
+
+static const Effect* activeEffect = &kEffects[0];
+
+void setupEffects(uint32_t seed) {
+  buildLuts(seed);
+  stats = EffectStats();
+}
+
+void initEffectState(EffectState& state, uint32_t seed) {
+  state.prng = mixSeed(seed);
+  state.gust = 0;
+  state.phase = (uint8_t)(nextRandom(state.prng) >> 24);
+}
+
+void renderEffect(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t nowMs,
+                  int8_t direction, EffectState& state) {
+  uint32_t start = micros();
+  activeEffect->render(pixels, count, color, nowMs, direction, state);
+  uint32_t elapsed = micros() - start;
+
+  stats.lastRenderUs = elapsed;
+  if (elapsed > stats.maxRenderUs) {
+    stats.maxRenderUs = elapsed;
+  }
+  uint32_t budgetUs = 20 + ((uint32_t)count * activeEffect->budgetNsPerPixel) / 1000;
+  if (elapsed > budgetUs) {
+    if (stats.overruns == 0) {
+      LOG_PRINTF("Effekt %s ueber Budget: %u us > %u us\n", activeEffect->name,
+                 (unsigned)elapsed, (unsigned)budgetUs);
+    }
+    stats.overruns++;
+  }
+}
+
+bool setEffect(const char* name) {
+  for (const Effect& effect : kEffects) {
+    if (strcmp(effect.name, name) == 0) {
+      activeEffect = &effect;
+      stats = EffectStats();
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* getEffectName() {
+  return activeEffect->name;
+}
+
+bool isEffectAnimated() {
+  return activeEffect->animated;
+}
+
+EffectStats getEffectStats() {
+  return stats;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <FastLED.h>
+
+struct EffectStats {
+  uint32_t lastRenderUs;
+  uint32_t maxRenderUs;
+  uint32_t overruns;
+};
+
+// What an effect carries from frame to frame; one per segment so zones
+// flicker independently.
+struct EffectState {
+  uint32_t prng;
+  uint8_t gust;
+  uint8_t phase;
+};
+
+// seed should differ per device (e.g. the efuse id) so lamps in a row do
+// not flicker in lockstep.
+void setupEffects(uint32_t seed);
+void initEffectState(EffectState& state, uint32_t seed);
+// Renders the active effect for one strip segment into pixels. direction +1
+// runs the chase from the first to the last pixel, -1 the other way.
+void renderEffect(CRGB* pixels, uint16_t count, const CRGB& color, uint32_t nowMs,
+                  int8_t direction, EffectState& state);
+bool setEffect(const char* name);
+const char* getEffectName();
+// False for effects whose output only depends on the color (solid).
+bool isEffectAnimated();
+EffectStats getEffectStats();
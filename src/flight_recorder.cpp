@@ -0,0 +1,156 @@
+#include "flight_recorder.h"
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <rom/crc.h>
+
+#define FLIGHT_MAGIC 0x46524543u  // "FREC"
+#define FLIGHT_EVENTS 8
+#define FLIGHT_TASK_RUNS 6
+#define FLIGHT_NAME_LEN 16
+
+struct FlightEvent {
+  uint32_t ms;
+  int8_t zone;
+  char name[FLIGHT_NAME_LEN];
+};
+
+struct FlightTaskRun {
+  uint32_t ms;
+  uint32_t runUs;
+  char name[FLIGHT_NAME_LEN];
+};
+
+struct FlightRecord {
+  uint32_t magic;
+  uint32_t uptimeMs;
+  // Set while a task runs; an empty name means the crash was outside a task.
+  char currentTask[FLIGHT_NAME_LEN];
+  uint32_t currentTaskMs;
+  uint32_t maxRunUs;
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;
+  uint32_t largestBlock;
+  uint8_t nextEvent;
+  uint8_t nextRun;
+  FlightEvent events[FLIGHT_EVENTS];
+  FlightTaskRun runs[FLIGHT_TASK_RUNS];
+  uint32_t crc;
+};
+
+// Left alone by the bootloader on software, panic and watchdog resets.
+static RTC_NOINIT_ATTR FlightRecord record;
+static FlightRecord crashed;
+static bool crashValid = false;
+
+static uint32_t recordCrc(const FlightRecord& r) {
+  return crc32_le(0, (const uint8_t*)&r, offsetof(FlightRecord, crc));
+}
+
+// Every write re-seals the record so a crash at any point leaves it valid.
+static void seal() {
+  record.uptimeMs = millis();
+  record.crc = recordCrc(record);
+}
+
+static void copyName(char* out, const char* name) {
+  strlcpy(out, name ? name : "", FLIGHT_NAME_LEN);
+}
+
+void setupFlightRecorder(bool abnormalReset) {
+  crashValid = abnormalReset && record.magic == FLIGHT_MAGIC && record.crc == recordCrc(record);
+  if (crashValid) {
+    crashed = record;
+  }
+  memset(&record, 0, sizeof(record));
+  record.magic = FLIGHT_MAGIC;
+  seal();
+}
+
+void flightRecordEvent(const char* event, int8_t zone) {
+  FlightEvent& e = record.events[record.nextEvent];
+  e.ms = millis();
+  e.zone = zone;
+  copyName(e.name, event);
+  record.nextEvent = (record.nextEvent + 1) % FLIGHT_EVENTS;
+  seal();
+}
+
+void flightRecordTaskStart(const char* name) {
+  copyName(record.currentTask, name);
+  record.currentTaskMs = millis();
+  seal();
+}
+
+void flightRecordTaskEnd(uint32_t runUs) {
+  FlightTaskRun& run = record.runs[record.nextRun];
+  run.ms = record.currentTaskMs;
+  run.runUs = runUs;
+  memcpy(run.name, record.currentTask, FLIGHT_NAME_LEN);
+  record.nextRun = (record.nextRun + 1) % FLIGHT_TASK_RUNS;
+  if (runUs > record.maxRunUs) {
+    record.maxRunUs = runUs;
+  }
+  record.currentTask[0] = '\0';
+  seal();
+}
+
+void flightRecordHeap(uint32_t freeBytes, uint32_t minFreeBytes, uint32_t largestBlock) {
+  record.freeHeap = freeBytes;
+  record.minFreeHeap = minFreeBytes;
+  record.largestBlock = largestBlock;
+  seal();
+}
+
+bool hasCrashRecord() {
+  return crashValid;
+}
+
+// Appends one whole entry to out at *len. An entry that does not fit is
+// dropped entirely and false is returned, so lists never end mid-entry.
+static bool appendf(char* out, size_t size, size_t* len, const char* fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  int written = vsnprintf(out + *len, size - *len, fmt, args);
+  va_end(args);
+  if (written < 0 || (size_t)written >= size - *len) {
+    out[*len] = '\0';
+    return false;
+  }
+  *len += written;
+  return true;
+}
+
+void formatCrashSummary(char* out, size_t size) {
+  size_t len = 0;
+  out[0] = '\0';
+  if (!crashValid) return;
+  const FlightRecord& r = crashed;
+  appendf(out, size, &len, "task=%s up=%lus heap=%u min=%u block=%u max_run=%uus runs=",
+          r.currentTask[0] ? r.currentTask : "-", (unsigned long)(r.uptimeMs / 1000),
+          (unsigned)r.freeHeap, (unsigned)r.minFreeHeap, (unsigned)r.largestBlock,
+          (unsigned)r.maxRunUs);
+  for (uint8_t i = 1; i <= FLIGHT_TASK_RUNS; i++) {
+    const FlightTaskRun& run = r.runs[(r.nextRun + FLIGHT_TASK_RUNS - i) % FLIGHT_TASK_RUNS];
+    if (run.name[0] == '\0') break;
+    if (!appendf(out, size, &len, "%s%s:%u", i > 1 ? "," : "", run.name, (unsigned)run.runUs)) break;
+  }
+}
+
+void formatCrashEvents(char* out, size_t size) {
+  size_t len = 0;
+  out[0] = '\0';
+  if (!crashValid) return;
+  const FlightRecord& r = crashed;
+  for (uint8_t i = 1; i <= FLIGHT_EVENTS; i++) {
+    const FlightEvent& e = r.events[(r.nextEvent + FLIGHT_EVENTS - i) % FLIGHT_EVENTS];
+    if (e.name[0] == '\0') break;
+    char zone[8] = "";
+    if (e.zone >= 0) {
+      snprintf(zone, sizeof(zone), "/%d", e.zone);
+    }
+    if (!appendf(out, size, &len, "%s%s%s@-%lus", i > 1 ? "," : "", e.name, zone,
+                 (unsigned long)((r.uptimeMs - e.ms) / 1000))) {
+      break;
+    }
+  }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Small binary record in RTC memory that survives panics and watchdog
+// resets. It holds the last events, the last scheduler task runs and heap
+// figures; a CRC guards against reading garbage after power-on.
+void setupFlightRecorder(bool abnormalReset);
+
+void flightRecordEvent(const char* event, int8_t zone);
+void flightRecordTaskStart(const char* name);
+void flightRecordTaskEnd(uint32_t runUs);
+void flightRecordHeap(uint32_t freeBytes, uint32_t minFreeBytes, uint32_t largestBlock);
+
+// Valid only after an abnormal reset with an intact record.
+bool hasCrashRecord();
+// Both keep only whole entries, newest first, as many as fit into out.
+// Task in progress, uptime, heap and recent task timings.
+void formatCrashSummary(char* out, size_t size);
+// Recent events with their age relative to the crash.
+void formatCrashEvents(char* out, size_t size);
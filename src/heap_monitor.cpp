@@ -0,0 +1,108 @@
+#include "heap_monitor.h"
+#include <Arduino.h>
+#include <assert.h>
+#include "flight_recorder.h"
+#include "log.h"
+#include "scheduler.h"
+
+#ifndef HEAP_SAMPLE_INTERVAL_MS
+#define HEAP_SAMPLE_INTERVAL_MS 10000
+#endif
+
+#ifndef HEAP_REPORT_EVERY_SAMPLES
+#define HEAP_REPORT_EVERY_SAMPLES 30
+#endif
+
+// Allocations during boot, first connects and schedule load are expected.
+#ifndef HEAP_DEBUG_WARMUP_MS
+#define HEAP_DEBUG_WARMUP_MS 120000
+#endif
+
+static HeapStats stats;
+static uint32_t samples = 0;
+
+#ifdef HEAP_DEBUG
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static TaskHandle_t loopTask = nullptr;
+static volatile uint32_t loopAllocs = 0;
+
+static inline void countAlloc() {
+  if (loopTask && xTaskGetCurrentTaskHandle() == loopTask) {
+    loopAllocs++;
+  }
+}
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  countAlloc();
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  countAlloc();
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  countAlloc();
+  return __real_realloc(ptr, size);
+}
+}
+#endif
+
+static void sampleHeap() {
+  uint32_t freeBytes = ESP.getFreeHeap();
+  uint32_t largest = ESP.getMaxAllocHeap();
+  stats.freeBytes = freeBytes;
+  stats.largestBlock = largest;
+  if (samples == 0 || freeBytes < stats.minFreeBytes) stats.minFreeBytes = freeBytes;
+  if (samples == 0 || largest < stats.minLargestBlock) stats.minLargestBlock = largest;
+  flightRecordHeap(stats.freeBytes, stats.minFreeBytes, stats.largestBlock);
+
+  if (samples % HEAP_REPORT_EVERY_SAMPLES == 0) {
+    LOG_PRINTF("Heap: frei %u (min %u), groesster Block %u (min %u)\n", (unsigned)stats.freeBytes,
+               (unsigned)stats.minFreeBytes, (unsigned)stats.largestBlock,
+               (unsigned)stats.minLargestBlock);
+  }
+  samples++;
+}
+
+void setupHeapMonitor() {
+#ifdef HEAP_DEBUG
+  loopTask = xTaskGetCurrentTaskHandle();
+#endif
+  sampleHeap();
+  addPeriodicTask("heap", sampleHeap, HEAP_SAMPLE_INTERVAL_MS, PRIO_LOW);
+}
+
+HeapStats getHeapStats() {
+  return stats;
+}
+
+void heapDebugBeginTask() {
+#ifdef HEAP_DEBUG
+  loopAllocs = 0;
+#endif
+}
+
+uint32_t heapDebugEndTask() {
+#ifdef HEAP_DEBUG
+  return loopAllocs;
+#else
+  return 0;
+#endif
+}
+
+void heapDebugCheck(const char* task, uint32_t allocs, bool mayAllocate) {
+#ifdef HEAP_DEBUG
+  if (allocs == 0 || mayAllocate || millis() < HEAP_DEBUG_WARMUP_MS) return;
+  LOG_PRINTF("HEAP_DEBUG: Task %s hat %u Allokation(en) im Dauerbetrieb\n", task, (unsigned)allocs);
+  assert(allocs == 0);
+#endif
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+struct HeapStats {
+  uint32_t freeBytes;
+  uint32_t minFreeBytes;
+  uint32_t largestBlock;
+  uint32_t minLargestBlock;
+};
+
+// Samples free heap and the largest free block over time.
+void setupHeapMonitor();
+HeapStats getHeapStats();
+
+// Allocation counting on the loop task. Counts only in -DHEAP_DEBUG builds,
+// which link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc (see the
+// esp32dev_heapdebug env); otherwise these return 0.
+void heapDebugBeginTask();
+uint32_t heapDebugEndTask();
+// Past warm-up, a task that may not allocate but did is logged and asserted.
+void heapDebugCheck(const char* task, uint32_t allocs, bool mayAllocate);
@@ -1,87 +1,281 @@
 #include "leds.h"
 #include <Arduino.h>
+#include "effects.h"
 #include "log.h"
 #include "pir.h"
+#include "scheduler.h"
 
-#define LED_PIN 5
-#define NUM_LEDS 20
+// Up to four strips, each on its own pin. FastLED drives every strip on its
+// own RMT channel and sends them in parallel (or via I2S with
+// -DFASTLED_ESP32_I2S), so long strips cost the time of the longest one.
+#ifndef LED_SEG0_PIN
+#define LED_SEG0_PIN 5
+#endif
+#ifndef LED_SEG0_COUNT
+#define LED_SEG0_COUNT 20
+#endif
+#ifndef LED_SEG1_PIN
+#define LED_SEG1_PIN 18
+#endif
+#ifndef LED_SEG1_COUNT
+#define LED_SEG1_COUNT 0
+#endif
+#ifndef LED_SEG2_PIN
+#define LED_SEG2_PIN 19
+#endif
+#ifndef LED_SEG2_COUNT
+#define LED_SEG2_COUNT 0
+#endif
+#ifndef LED_SEG3_PIN
+#define LED_SEG3_PIN 21
+#endif
+#ifndef LED_SEG3_COUNT
+#define LED_SEG3_COUNT 0
+#endif
+
+#define NUM_LEDS (LED_SEG0_COUNT + LED_SEG1_COUNT + LED_SEG2_COUNT + LED_SEG3_COUNT)
+#define MAX_LED_SEGMENTS 4
+
+#ifndef LED_FRAME_INTERVAL_MS
+#define LED_FRAME_INTERVAL_MS 20
+#endif
+
+#ifndef FADE_STEP_INTERVAL_MS
+#define FADE_STEP_INTERVAL_MS 80
+#endif
+
+#ifndef LED_STATS_INTERVAL_MS
+#define LED_STATS_INTERVAL_MS 60000
+#endif
 
 // static const int MAX_BRIGHTNESS = 255;
 static const int MAX_BRIGHTNESS = 150;
 #define FADE_SPEED 5
 
+// Each segment is one lamp (zone) with its own fade state.
+struct LedSegment {
+  uint16_t offset;
+  uint16_t count;
+  int brightness;
+  int8_t direction;
+  EffectState effect;
+  bool lightsOn;
+  bool shouldFadeIn;
+  bool shouldFadeOut;
+  bool dirty;  // rendered or brightness changed since the last push
+};
+
+// leds[] is written by the effect renderer; frontLeds[] is what the controllers
+// send, scaled by each segment's brightness. Only dirty segments are scaled
+// into the front buffer.
 CRGB leds[NUM_LEDS];
+static CRGB frontLeds[NUM_LEDS];
+static LedSegment segments[MAX_LED_SEGMENTS];
+static size_t segmentCount = 0;
+
+static LedFrameStats frameStats;
+static uint32_t frameTimeSumUs = 0;
+static uint32_t pixelsSinceReport = 0;
+static uint32_t framesSinceReport = 0;
+static const char* renderedEffect = nullptr;
+
 // CRGB targetColor = CRGB(255, 255, 255);
 CRGB targetColor = CRGB(255, 140, 60); // Warmweiß
 // CRGB targetColor = CRGB(255, 0, 0); // Rot
 
-bool lightsOn = false;
-bool shouldFadeIn = false;
-bool shouldFadeOut = false;
-int currentBrightness = 0;
+template <uint8_t PIN>
+static void addSegment(uint16_t count) {
+  if (count == 0 || segmentCount >= MAX_LED_SEGMENTS) return;
+  uint16_t offset = 0;
+  if (segmentCount > 0) {
+    const LedSegment& prev = segments[segmentCount - 1];
+    offset = prev.offset + prev.count;
+  }
+  FastLED.addLeds<WS2812B, PIN, GRB>(frontLeds + offset, count);
+  LedSegment& seg = segments[segmentCount++];
+  seg = LedSegment();
+  seg.offset = offset;
+  seg.count = count;
+  seg.direction = 1;
+  initEffectState(seg.effect, (uint32_t)ESP.getEfuseMac() + segmentCount * 0x9E3779B9u);
+}
+
+static void reportFrameStats() {
+  if (framesSinceReport == 0) return;
+  EffectStats effect = getEffectStats();
+  LOG_PRINTF("LED Frames: avg %u Pixel, %u Frames, avg %u us, max %u us; Effekt %s max %u us, %u Overruns\n",
+             (unsigned)(pixelsSinceReport / framesSinceReport), (unsigned)framesSinceReport,
+             (unsigned)(frameTimeSumUs / framesSinceReport), (unsigned)frameStats.maxFrameUs,
+             getEffectName(), (unsigned)effect.maxRenderUs, (unsigned)effect.overruns);
+  frameTimeSumUs = 0;
+  pixelsSinceReport = 0;
+  framesSinceReport = 0;
+}
+
+// Scales the dirty segments into the front buffer and pushes a frame. The
+// ESP32 RMT and I2S drivers batch all controllers into one transfer, so the
+// frame always goes out through FastLED.show(); a single controller's
+// showLeds() would stall until the next full show.
+static void showLEDs() {
+  uint32_t pixels = 0;
+  for (size_t i = 0; i < segmentCount; i++) {
+    LedSegment& seg = segments[i];
+    if (!seg.dirty) continue;
+    uint8_t scale = (uint8_t)seg.brightness;
+    for (uint16_t p = seg.offset; p < seg.offset + seg.count; p++) {
+      frontLeds[p] = leds[p];
+      frontLeds[p].nscale8_video(scale);
+    }
+    pixels += seg.count;
+    seg.dirty = false;
+  }
+  if (pixels == 0) return;
+
+  uint32_t start = micros();
+  FastLED.show();
+  uint32_t elapsed = micros() - start;
+
+  frameStats.pixels = pixels;
+  frameStats.frames++;
+  frameStats.lastFrameUs = elapsed;
+  if (elapsed > frameStats.maxFrameUs) {
+    frameStats.maxFrameUs = elapsed;
+  }
+  frameTimeSumUs += elapsed;
+  pixelsSinceReport += pixels;
+  framesSinceReport++;
+}
+
+static void updateLEDs() {
+  uint32_t now = millis();
+  bool animated = isEffectAnimated();
+  // A new effect has to be rendered once even if it is static.
+  bool effectChanged = renderedEffect != getEffectName();
+  renderedEffect = getEffectName();
+  for (size_t i = 0; i < segmentCount; i++) {
+    LedSegment& seg = segments[i];
+    // Dark segments keep their last pixels; brightness 0 blanks them.
+    if (seg.lightsOn && (animated || effectChanged || seg.dirty)) {
+      renderEffect(leds + seg.offset, seg.count, targetColor, now, seg.direction, seg.effect);
+      seg.dirty = true;
+    }
+  }
+  showLEDs();
+}
+
+static void updateFade() {
+  for (size_t i = 0; i < segmentCount; i++) {
+    LedSegment& seg = segments[i];
+    if (seg.shouldFadeIn || seg.shouldFadeOut) {
+      seg.dirty = true;
+    }
+    if (seg.shouldFadeIn) {
+      seg.brightness += FADE_SPEED;
+      if (seg.brightness >= MAX_BRIGHTNESS) {
+        seg.brightness = MAX_BRIGHTNESS;
+        seg.shouldFadeIn = false;
+        LOG_PRINTF("Fade-In fertig (Segment %u)\n", (unsigned)i);
+      }
+    }
+
+    if (seg.shouldFadeOut) {
+      seg.brightness -= FADE_SPEED;
+      if (seg.brightness <= 0) {
+        seg.brightness = 0;
+        seg.shouldFadeOut = false;
+        seg.lightsOn = false;
+        LOG_PRINTF("Fade-Out fertig (Segment %u)\n", (unsigned)i);
+      }
+    }
+  }
+}
 
 void setupLEDs() {
-  FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds, NUM_LEDS);
-  FastLED.setBrightness(0);
+  addSegment<LED_SEG0_PIN>(LED_SEG0_COUNT);
+  addSegment<LED_SEG1_PIN>(LED_SEG1_COUNT);
+  addSegment<LED_SEG2_PIN>(LED_SEG2_COUNT);
+  addSegment<LED_SEG3_PIN>(LED_SEG3_COUNT);
+  setupEffects((uint32_t)ESP.getEfuseMac());
+  addPeriodicTask("leds", updateLEDs, LED_FRAME_INTERVAL_MS, PRIO_HIGH);
+  addPeriodicTask("fade", updateFade, FADE_STEP_INTERVAL_MS, PRIO_HIGH);
+  addPeriodicTask("led_stats", reportFrameStats, LED_STATS_INTERVAL_MS, PRIO_LOW);
+
   fill_solid(leds, NUM_LEDS, CRGB::Black);
+  fill_solid(frontLeds, NUM_LEDS, CRGB::Black);
+  FastLED.setBrightness(255);
   FastLED.show();
   LOG_PRINTLN("LEDs initialisiert!");
-  logEvent("leds_init", lightsOn, currentBrightness, getMotionState(), nullptr);
+  logEvent("leds_init", isLightOn(), getCurrentBrightness(), getMotionState(), nullptr);
 }
 
-void startFadeIn() {
-  if (shouldFadeIn) return;
-  lightsOn = true;
-  shouldFadeIn = true;
-  shouldFadeOut = false;
-  LOG_PRINTLN("Fade-In startet...");
+size_t getLedSegmentCount() {
+  return segmentCount;
 }
 
-void startFadeOut() {
-  if (shouldFadeOut || !lightsOn) return;
-  shouldFadeOut = true;
-  LOG_PRINTLN("Fade-Out startet...");
+void startFadeIn(uint8_t segment) {
+  if (segment >= segmentCount) return;
+  LedSegment& seg = segments[segment];
+  if (seg.shouldFadeIn) return;
+  seg.lightsOn = true;
+  seg.shouldFadeIn = true;
+  seg.shouldFadeOut = false;
+  seg.dirty = true;
+  frameStats.fadeIns++;
+  LOG_PRINTF("Fade-In startet (Segment %u)...\n", (unsigned)segment);
 }
 
-bool isLightOn() {
-  return lightsOn;
+void startFadeOut(uint8_t segment) {
+  if (segment >= segmentCount) return;
+  LedSegment& seg = segments[segment];
+  if (seg.shouldFadeOut || !seg.lightsOn) return;
+  seg.shouldFadeOut = true;
+  frameStats.fadeOuts++;
+  LOG_PRINTF("Fade-Out startet (Segment %u)...\n", (unsigned)segment);
 }
 
-int getCurrentBrightness() {
-  return currentBrightness;
+void setSegmentDirection(uint8_t segment, int8_t direction) {
+  if (segment >= segmentCount) return;
+  segments[segment].direction = direction < 0 ? -1 : 1;
+  segments[segment].dirty = true;
 }
 
-bool isFadeActive() {
-  return shouldFadeIn || shouldFadeOut;
+bool isLightOn(uint8_t segment) {
+  return segment < segmentCount && segments[segment].lightsOn;
 }
 
-void updateFade() {
-  if (shouldFadeIn) {
-    currentBrightness += FADE_SPEED;
-    if (currentBrightness >= MAX_BRIGHTNESS) {
-      currentBrightness = MAX_BRIGHTNESS;
-      shouldFadeIn = false;
-      LOG_PRINTLN("Fade-In fertig");
-      logEvent("light_on", lightsOn, currentBrightness, getMotionState(), "fade_in_complete");
-    }
-    FastLED.setBrightness(currentBrightness);
-    fill_solid(leds, NUM_LEDS, targetColor);
-    FastLED.show();
-    delay(30);
+int getCurrentBrightness(uint8_t segment) {
+  return segment < segmentCount ? segments[segment].brightness : 0;
+}
+
+bool isFadeActive(uint8_t segment) {
+  if (segment >= segmentCount) return false;
+  return segments[segment].shouldFadeIn || segments[segment].shouldFadeOut;
+}
+
+bool isLightOn() {
+  for (size_t i = 0; i < segmentCount; i++) {
+    if (segments[i].lightsOn) return true;
   }
+  return false;
+}
 
-  if (shouldFadeOut) {
-    currentBrightness -= FADE_SPEED;
-    if (currentBrightness <= 0) {
-      currentBrightness = 0;
-      shouldFadeOut = false;
-      lightsOn = false;
-      LOG_PRINTLN("Fade-Out fertig");
-      logEvent("light_off", lightsOn, currentBrightness, getMotionState(), "fade_out_complete");
+int getCurrentBrightness() {
+  int brightest = 0;
+  for (size_t i = 0; i < segmentCount; i++) {
+    if (segments[i].brightness > brightest) {
+      brightest = segments[i].brightness;
     }
-    FastLED.setBrightness(currentBrightness);
-    fill_solid(leds, NUM_LEDS, targetColor);
-    FastLED.show();
-    delay(30);
   }
+  return brightest;
+}
+
+bool isFadeActive() {
+  for (size_t i = 0; i < segmentCount; i++) {
+    if (isFadeActive(i)) return true;
+  }
+  return false;
+}
+
+LedFrameStats getLedFrameStats() {
+  return frameStats;
 }
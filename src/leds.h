@@ -1,10 +1,27 @@
 #pragma once
 #include <FastLED.h>
 
+struct LedFrameStats {
+  uint32_t pixels;  // pushed in the last frame
+  uint32_t frames;
+  uint32_t lastFrameUs;
+  uint32_t maxFrameUs;
+  uint32_t fadeIns;
+  uint32_t fadeOuts;
+};
+
 void setupLEDs();
-void startFadeIn();
-void startFadeOut();
-void updateFade();
+size_t getLedSegmentCount();
+void startFadeIn(uint8_t segment);
+void startFadeOut(uint8_t segment);
+// +1 runs directional effects from the first to the last pixel, -1 back.
+void setSegmentDirection(uint8_t segment, int8_t direction);
+bool isLightOn(uint8_t segment);
+int getCurrentBrightness(uint8_t segment);
+bool isFadeActive(uint8_t segment);
+
+// Whole controller: any segment lit, brightest segment, any fade running.
 bool isLightOn();
 int getCurrentBrightness();
 bool isFadeActive();
+LedFrameStats getLedFrameStats();
@@ -1,20 +1,54 @@
 #include "log.h"
 #include <WiFi.h>
 #include <HTTPClient.h>
-#include <WiFiClientSecure.h>
+#include "flight_recorder.h"
+#include "heap_monitor.h"
 #include "leds.h"
+#include "mqtt_client.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include "tls_pool.h"
+#include "zones.h"
+
+#ifndef METRICS_PORT
+#define METRICS_PORT 9100
+#endif
+
+#ifndef METRICS_REQUEST_TIMEOUT_MS
+#define METRICS_REQUEST_TIMEOUT_MS 1000
+#endif
 
 static WiFiServer telnetServer(23);
 static WiFiClient telnetClient;
 static bool serverStarted = false;
 
+// Prometheus scrape endpoint, one client at a time. The request line is
+// collected across ticks so a slow client never blocks the loop.
+static WiFiServer metricsServer(METRICS_PORT);
+static WiFiClient metricsClient;
+static unsigned long metricsClientSinceMs = 0;
+static char metricsRequest[64];
+static size_t metricsRequestLen = 0;
+
+static uint32_t uploadsOk = 0;
+static uint32_t uploadsFailed = 0;
+
 static bool sendQueuedEvent();
 static bool canSendNow();
+static void handleLog();
+static void uploadLog();
+static void flushAggregates();
+static void handleMetrics();
 
 #ifndef LOG_QUEUE_SIZE
 #define LOG_QUEUE_SIZE 30
 #endif
 
+// Slots only critical events may use, so they survive long outages.
+#ifndef LOG_QUEUE_CRITICAL_RESERVE
+#define LOG_QUEUE_CRITICAL_RESERVE 5
+#endif
+
 #ifndef LOG_SEND_INTERVAL_MS
 #define LOG_SEND_INTERVAL_MS 5000
 #endif
@@ -23,20 +57,75 @@ static bool canSendNow();
 #define LOG_HTTP_TIMEOUT_MS 1000
 #endif
 
+// Flapping PIR sensors fold their motion_on/motion_off bursts into one
+// motion_summary per zone and window. The first event of a window still goes
+// out immediately; all other events bypass aggregation.
+#ifndef LOG_AGGREGATE_WINDOW_MS
+#define LOG_AGGREGATE_WINDOW_MS 60000
+#endif
+
+struct MotionWindow {
+  bool open;
+  bool motion;
+  bool lightsOn;
+  int brightness;
+  uint16_t activations;
+  uint16_t folded;
+  uint32_t firstMs;
+  uint32_t lastMs;
+  uint32_t onSinceMs;
+  uint32_t onMs;
+};
+
+static MotionWindow motionWindows[MAX_ZONES];
+
 struct LogEventItem {
+  bool used;
+  LogPriority priority;
+  uint32_t sequence;
   char event[32];
+  int8_t zone;
   bool lightsOn;
   int brightness;
   bool motion;
   bool hasMessage;
-  char message[96];
+  char message[128];
 };
 
+// Slots are not kept in order: eviction can free any slot. Uploads go out
+// by sequence number, oldest first.
 static LogEventItem logQueue[LOG_QUEUE_SIZE];
-static size_t logQueueHead = 0;
-static size_t logQueueTail = 0;
 static size_t logQueueCount = 0;
-static unsigned long lastSendAttemptMs = 0;
+static size_t criticalCount = 0;
+static uint32_t nextSequence = 0;
+static LogQueueStats queueStats;
+
+struct PriorityRule {
+  const char* event;
+  LogPriority priority;
+};
+
+// Events not listed here are Normal.
+static const PriorityRule kPriorityRules[] = {
+    {"reset_reason", LogPriority::Critical},
+    {"crash_report", LogPriority::Critical},
+    {"crash_events", LogPriority::Critical},
+    {"boot", LogPriority::Critical},
+    {"ota_error", LogPriority::Critical},
+    {"schedule_error", LogPriority::Critical},
+    {"wifi_connect_fail", LogPriority::Critical},
+    {"motion_on", LogPriority::Low},
+    {"motion_off", LogPriority::Low},
+    {"motion_summary", LogPriority::Low},
+    {"effect_change", LogPriority::Low},
+};
+
+static LogPriority priorityForEvent(const char* event) {
+  for (const PriorityRule& rule : kPriorityRules) {
+    if (strcmp(rule.event, event) == 0) return rule.priority;
+  }
+  return LogPriority::Normal;
+}
 
 #ifndef LOGS_ENDPOINT
 #define LOGS_ENDPOINT ""
@@ -48,12 +137,19 @@ static unsigned long lastSendAttemptMs = 0;
 
 void setupLog() {
   serverStarted = false;
+  // Accepting a telnet client and HTTPClient requests allocate internally.
+  allowTaskAllocations(addPeriodicTask("log", handleLog, 50, PRIO_NORMAL));
+  allowTaskAllocations(addPeriodicTask("log_upload", uploadLog, LOG_SEND_INTERVAL_MS, PRIO_LOW));
+  addPeriodicTask("log_aggregate", flushAggregates, 1000, PRIO_LOW);
+  // Accepting a client allocates inside WiFiServer; rendering does not.
+  allowTaskAllocations(addPeriodicTask("metrics", handleMetrics, 50, PRIO_LOW));
 }
 
-void handleLog() {
+static void handleLog() {
   if (!serverStarted && WiFi.status() == WL_CONNECTED) {
     telnetServer.begin();
     telnetServer.setNoDelay(true);
+    metricsServer.begin();
     serverStarted = true;
   }
   if (!serverStarted) {
@@ -73,9 +169,11 @@ void handleLog() {
       telnetClient.read();
     }
   }
+}
 
+static void uploadLog() {
   if (logQueueCount > 0 && canSendNow()) {
-    // Try to send one queued event per loop.
+    // Send one queued event per interval.
     sendQueuedEvent();
   }
 }
@@ -115,6 +213,141 @@ void logPrintf(const char* fmt, ...) {
   writeToOutputs(buffer);
 }
 
+// Formats one line on the stack and writes it straight into the socket.
+static void writeMetric(WiFiClient& client, const char* fmt, ...) {
+  char line[160];
+  va_list args;
+  va_start(args, fmt);
+  int len = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (len <= 0) return;
+  if ((size_t)len >= sizeof(line)) len = sizeof(line) - 1;
+  client.write((const uint8_t*)line, len);
+}
+
+static void writeMetricHeader(WiFiClient& client, const char* name, const char* type, const char* help) {
+  writeMetric(client, "# HELP raillamp_%s %s\n# TYPE raillamp_%s %s\n", name, help, name, type);
+}
+
+static void writeMetrics(WiFiClient& client) {
+  static const char* const kPriorityNames[kLogPriorityCount] = {"low", "normal", "critical"};
+
+  writeMetric(client, "HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                      "Connection: close\r\n\r\n");
+
+  LoopLatencyHistogram latency = getLoopLatencyHistogram();
+  writeMetricHeader(client, "loop_latency_ms", "histogram", "How late scheduler tasks start.");
+  uint32_t cumulative = 0;
+  for (size_t i = 0; i < LOOP_LATENCY_BUCKETS; i++) {
+    cumulative += latency.buckets[i];
+    writeMetric(client, "raillamp_loop_latency_ms_bucket{le=\"%u\"} %u\n",
+                (unsigned)kLoopLatencyBucketsMs[i], (unsigned)cumulative);
+  }
+  writeMetric(client, "raillamp_loop_latency_ms_bucket{le=\"+Inf\"} %u\n", (unsigned)latency.count);
+  writeMetric(client, "raillamp_loop_latency_ms_sum %llu\n", (unsigned long long)latency.sumMs);
+  writeMetric(client, "raillamp_loop_latency_ms_count %u\n", (unsigned)latency.count);
+
+  HeapStats heap = getHeapStats();
+  writeMetricHeader(client, "heap_free_bytes", "gauge", "Free heap at the last sample.");
+  writeMetric(client, "raillamp_heap_free_bytes %u\n", (unsigned)heap.freeBytes);
+  writeMetricHeader(client, "heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+  writeMetric(client, "raillamp_heap_min_free_bytes %u\n", (unsigned)heap.minFreeBytes);
+  writeMetricHeader(client, "heap_largest_block_bytes", "gauge", "Largest free heap block.");
+  writeMetric(client, "raillamp_heap_largest_block_bytes %u\n", (unsigned)heap.largestBlock);
+
+  writeMetricHeader(client, "wifi_rssi_dbm", "gauge", "WiFi signal strength.");
+  writeMetric(client, "raillamp_wifi_rssi_dbm %d\n", (int)WiFi.RSSI());
+  writeMetricHeader(client, "uptime_seconds", "counter", "Seconds since boot.");
+  writeMetric(client, "raillamp_uptime_seconds %lu\n", (unsigned long)(millis() / 1000));
+
+  LogQueueStats queue = getLogQueueStats();
+  writeMetricHeader(client, "log_queue_depth", "gauge", "Events waiting for upload.");
+  writeMetric(client, "raillamp_log_queue_depth %u\n", (unsigned)logQueueCount);
+  writeMetricHeader(client, "log_events_enqueued_total", "counter", "Events queued for upload.");
+  for (size_t p = 0; p < kLogPriorityCount; p++) {
+    writeMetric(client, "raillamp_log_events_enqueued_total{priority=\"%s\"} %u\n", kPriorityNames[p],
+                (unsigned)queue.enqueued[p]);
+  }
+  writeMetricHeader(client, "log_events_dropped_total", "counter", "Events evicted or rejected.");
+  for (size_t p = 0; p < kLogPriorityCount; p++) {
+    writeMetric(client, "raillamp_log_events_dropped_total{priority=\"%s\"} %u\n", kPriorityNames[p],
+                (unsigned)queue.dropped[p]);
+  }
+  writeMetricHeader(client, "log_uploads_total", "counter", "Event uploads to the log endpoint.");
+  writeMetric(client, "raillamp_log_uploads_total{result=\"ok\"} %u\n", (unsigned)uploadsOk);
+  writeMetric(client, "raillamp_log_uploads_total{result=\"error\"} %u\n", (unsigned)uploadsFailed);
+
+  MqttStats mqtt = getMqttStats();
+  writeMetricHeader(client, "mqtt_publishes_total", "counter", "MQTT status publishes.");
+  writeMetric(client, "raillamp_mqtt_publishes_total{result=\"ok\"} %u\n", (unsigned)mqtt.published);
+  writeMetric(client, "raillamp_mqtt_publishes_total{result=\"error\"} %u\n",
+              (unsigned)mqtt.publishFailed);
+  writeMetricHeader(client, "mqtt_connects_total", "counter", "Successful MQTT connects.");
+  writeMetric(client, "raillamp_mqtt_connects_total %u\n", (unsigned)mqtt.connects);
+
+  LedFrameStats leds = getLedFrameStats();
+  writeMetricHeader(client, "fades_total", "counter", "Fades started.");
+  writeMetric(client, "raillamp_fades_total{direction=\"in\"} %u\n", (unsigned)leds.fadeIns);
+  writeMetric(client, "raillamp_fades_total{direction=\"out\"} %u\n", (unsigned)leds.fadeOuts);
+
+  writeMetricHeader(client, "motion_events_total", "counter", "Rising motion edges per zone.");
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    writeMetric(client, "raillamp_motion_events_total{zone=\"%u\"} %u\n", (unsigned)z,
+                (unsigned)getZoneStatus(z).motionCount);
+  }
+  writeMetricHeader(client, "zone_light_on", "gauge", "1 while the zone is lit.");
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    writeMetric(client, "raillamp_zone_light_on{zone=\"%u\"} %d\n", (unsigned)z,
+                getZoneStatus(z).lightsOn ? 1 : 0);
+  }
+}
+
+static void closeMetricsClient() {
+  while (metricsClient.available()) {
+    metricsClient.read();
+  }
+  metricsClient.stop();
+  metricsRequestLen = 0;
+}
+
+static void handleMetrics() {
+  if (!serverStarted) return;
+
+  if (!metricsClient || !metricsClient.connected()) {
+    if (!metricsServer.hasClient()) return;
+    metricsClient = metricsServer.available();
+    metricsClientSinceMs = millis();
+    metricsRequestLen = 0;
+  }
+
+  // Only the request line matters; headers are drained on close.
+  bool lineComplete = false;
+  while (metricsClient.available() && !lineComplete) {
+    int c = metricsClient.read();
+    if (c == '\n') {
+      lineComplete = true;
+    } else if (c != '\r' && metricsRequestLen < sizeof(metricsRequest) - 1) {
+      metricsRequest[metricsRequestLen++] = (char)c;
+    }
+  }
+  metricsRequest[metricsRequestLen] = '\0';
+
+  if (!lineComplete) {
+    if (millis() - metricsClientSinceMs > METRICS_REQUEST_TIMEOUT_MS) {
+      closeMetricsClient();
+    }
+    return;
+  }
+
+  char next = metricsRequest[12];
+  if (strncmp(metricsRequest, "GET /metrics", 12) == 0 && (next == ' ' || next == '?' || next == '\0')) {
+    writeMetrics(metricsClient);
+  } else {
+    writeMetric(metricsClient, "HTTP/1.0 404 Not Found\r\nConnection: close\r\n\r\n");
+  }
+  closeMetricsClient();
+}
+
 static bool logsConfigured() {
   return strlen(LOGS_ENDPOINT) > 0 && strlen(LOGS_API_KEY) > 0;
 }
@@ -123,39 +356,107 @@ static bool canSendNow() {
   if (!logsConfigured()) return false;
   if (WiFi.status() != WL_CONNECTED) return false;
   if (isFadeActive()) return false;
-  unsigned long now = millis();
-  if (now - lastSendAttemptMs < LOG_SEND_INTERVAL_MS) return false;
-  lastSendAttemptMs = now;
   return true;
 }
 
-static void appendJsonEscaped(String& out, const char* input) {
-  if (!input) return;
-  for (const char* p = input; *p; ++p) {
+// Escapes input into out; every character needs at most two bytes.
+static void escapeJson(const char* input, char* out, size_t size) {
+  size_t len = 0;
+  for (const char* p = input; *p && len + 2 < size; ++p) {
     char c = *p;
     if (c == '\\' || c == '"') {
-      out += '\\';
-      out += c;
+      out[len++] = '\\';
+      out[len++] = c;
     } else if (c == '\n') {
-      out += "\\n";
+      out[len++] = '\\';
+      out[len++] = 'n';
     } else if (c == '\r') {
-      out += "\\r";
+      out[len++] = '\\';
+      out[len++] = 'r';
     } else if (c == '\t') {
-      out += "\\t";
+      out[len++] = '\\';
+      out[len++] = 't';
     } else {
-      out += c;
+      out[len++] = c;
     }
   }
+  out[len] = '\0';
 }
 
-static bool enqueueEvent(const char* event, bool lightsOn, int brightness, bool motion, const char* message) {
-  if (logQueueCount >= LOG_QUEUE_SIZE) {
-    // Drop oldest to make room.
-    logQueueHead = (logQueueHead + 1) % LOG_QUEUE_SIZE;
-    logQueueCount--;
+static size_t formatEventJson(const LogEventItem& item, char* out, size_t size) {
+  char event[2 * sizeof(item.event)];
+  char message[2 * sizeof(item.message)];
+  char zone[16] = "";
+  escapeJson(item.event, event, sizeof(event));
+  escapeJson(item.hasMessage ? item.message : "", message, sizeof(message));
+  if (item.zone >= 0) {
+    snprintf(zone, sizeof(zone), "\"zone\":%d,", item.zone);
   }
+  int len = snprintf(out, size, "{\"event\":\"%s\",%s\"lights_on\":%s,\"brightness\":%d,\"motion\":%s%s%s%s}",
+                     event, zone, item.lightsOn ? "true" : "false", item.brightness,
+                     item.motion ? "true" : "false", item.hasMessage ? ",\"message\":\"" : "",
+                     message, item.hasMessage ? "\"" : "");
+  if (len < 0 || (size_t)len >= size) return 0;
+  return len;
+}
+
+static void freeSlot(size_t index) {
+  LogEventItem& item = logQueue[index];
+  item.used = false;
+  logQueueCount--;
+  if (item.priority == LogPriority::Critical) {
+    criticalCount--;
+  }
+}
+
+// Lowest priority first, oldest within a class; only classes up to maxPriority.
+static int findEvictionVictim(LogPriority maxPriority) {
+  int victim = -1;
+  for (size_t i = 0; i < LOG_QUEUE_SIZE; i++) {
+    const LogEventItem& item = logQueue[i];
+    if (!item.used || item.priority > maxPriority) continue;
+    if (victim < 0 || item.priority < logQueue[victim].priority ||
+        (item.priority == logQueue[victim].priority &&
+         (int32_t)(item.sequence - logQueue[victim].sequence) < 0)) {
+      victim = i;
+    }
+  }
+  return victim;
+}
 
-  LogEventItem& item = logQueue[logQueueTail];
+static int findOldestQueued() {
+  int oldest = -1;
+  for (size_t i = 0; i < LOG_QUEUE_SIZE; i++) {
+    if (!logQueue[i].used) continue;
+    if (oldest < 0 || (int32_t)(logQueue[i].sequence - logQueue[oldest].sequence) < 0) {
+      oldest = i;
+    }
+  }
+  return oldest;
+}
+
+static bool enqueueEvent(int8_t zone, LogPriority priority, const char* event, bool lightsOn,
+                         int brightness, bool motion, const char* message) {
+  bool full = logQueueCount >= LOG_QUEUE_SIZE;
+  bool reserveReached = priority != LogPriority::Critical &&
+                        logQueueCount - criticalCount >= LOG_QUEUE_SIZE - LOG_QUEUE_CRITICAL_RESERVE;
+  if (full || reserveReached) {
+    // Never evict anything more important than the new event.
+    int victim = findEvictionVictim(priority);
+    if (victim < 0) {
+      queueStats.dropped[(size_t)priority]++;
+      return false;
+    }
+    queueStats.dropped[(size_t)logQueue[victim].priority]++;
+    freeSlot(victim);
+  }
+
+  size_t slot = 0;
+  while (logQueue[slot].used) {
+    slot++;
+  }
+
+  LogEventItem& item = logQueue[slot];
   item.event[0] = '\0';
   item.message[0] = '\0';
   item.hasMessage = false;
@@ -163,6 +464,7 @@ static bool enqueueEvent(const char* event, bool lightsOn, int brightness, bool
   if (event) {
     strlcpy(item.event, event, sizeof(item.event));
   }
+  item.zone = zone;
   item.lightsOn = lightsOn;
   item.brightness = brightness;
   item.motion = motion;
@@ -172,69 +474,148 @@ static bool enqueueEvent(const char* event, bool lightsOn, int brightness, bool
     item.hasMessage = true;
   }
 
-  logQueueTail = (logQueueTail + 1) % LOG_QUEUE_SIZE;
+  item.used = true;
+  item.priority = priority;
+  item.sequence = nextSequence++;
   logQueueCount++;
+  if (priority == LogPriority::Critical) {
+    criticalCount++;
+  }
+  queueStats.enqueued[(size_t)priority]++;
   return true;
 }
 
+// Returns true if the event was folded into the zone's open window.
+static bool aggregateMotion(uint8_t zone, const char* event, bool lightsOn, int brightness, bool motion) {
+  bool on = strcmp(event, "motion_on") == 0;
+  if (!on && strcmp(event, "motion_off") != 0) return false;
+  if (zone >= MAX_ZONES) return false;
+
+  MotionWindow& w = motionWindows[zone];
+  uint32_t now = millis();
+  bool first = !w.open;
+  if (first) {
+    w.open = true;
+    w.activations = 0;
+    w.folded = 0;
+    w.firstMs = now;
+    w.onMs = 0;
+    w.onSinceMs = now;
+  } else {
+    w.folded++;
+  }
+
+  if (w.motion && !on) {
+    w.onMs += now - w.onSinceMs;
+  } else if (!w.motion && on) {
+    w.onSinceMs = now;
+  }
+  if (on) w.activations++;
+  w.motion = on;
+  w.lightsOn = lightsOn;
+  w.brightness = brightness;
+  w.lastMs = now;
+  return !first;
+}
+
+static void flushAggregates() {
+  uint32_t now = millis();
+  for (uint8_t z = 0; z < MAX_ZONES; z++) {
+    MotionWindow& w = motionWindows[z];
+    if (!w.open || now - w.firstMs < LOG_AGGREGATE_WINDOW_MS) continue;
+
+    if (w.folded > 0) {
+      uint32_t onMs = w.onMs + (w.motion ? now - w.onSinceMs : 0);
+      uint32_t span = now - w.firstMs;
+      unsigned duty = span ? (unsigned)((uint64_t)onMs * 100 / span) : 0;
+      char message[96];
+      snprintf(message, sizeof(message), "count=%u events=%u first_ms=%lu last_ms=%lu duty=%u%%",
+               (unsigned)w.activations, (unsigned)w.folded + 1, (unsigned long)w.firstMs,
+               (unsigned long)w.lastMs, duty);
+      enqueueEvent(z, LogPriority::Low, "motion_summary", w.lightsOn, w.brightness, w.motion, message);
+    }
+    w.open = false;
+    w.onSinceMs = now;
+  }
+}
+
 static bool sendQueuedEvent() {
   if (!logsConfigured()) return false;
   if (WiFi.status() != WL_CONNECTED) return false;
   if (logQueueCount == 0) return false;
   if (isFadeActive()) return false;
 
-  LogEventItem& item = logQueue[logQueueHead];
+  int index = findOldestQueued();
+  if (index < 0) return false;
+  LogEventItem& item = logQueue[index];
   if (item.event[0] == '\0') return false;
 
-  WiFiClientSecure client;
-  client.setInsecure();
-
-  HTTPClient http;
-  if (!http.begin(client, LOGS_ENDPOINT)) {
-    http.end();
+  HTTPClient* http = acquireHttps(LOGS_ENDPOINT, LOG_HTTP_TIMEOUT_MS);
+  if (!http) {
+    uploadsFailed++;
     return false;
   }
-  http.setTimeout(LOG_HTTP_TIMEOUT_MS);
-  http.addHeader("Content-Type", "application/json");
-  String authHeader = String("Bearer ") + LOGS_API_KEY;
-  http.addHeader("Authorization", authHeader);
-
-  String payload = "{";
-  payload += "\"event\":\"";
-  appendJsonEscaped(payload, item.event);
-  payload += "\",";
-  payload += "\"lights_on\":";
-  payload += (item.lightsOn ? "true" : "false");
-  payload += ",";
-  payload += "\"brightness\":";
-  payload += String(item.brightness);
-  payload += ",";
-  payload += "\"motion\":";
-  payload += (item.motion ? "true" : "false");
-  if (item.hasMessage) {
-    payload += ",\"message\":\"";
-    appendJsonEscaped(payload, item.message);
-    payload += "\"";
-  }
-  payload += "}";
-
-  int status = http.POST(payload);
-  http.end();
+  http->addHeader("Authorization", "Bearer " LOGS_API_KEY);
+
+#if TELEMETRY_CBOR
+  uint8_t payload[192];
+  size_t length = encodeEventCbor(payload, sizeof(payload), item.event, item.zone, item.lightsOn,
+                                  item.brightness, item.motion,
+                                  item.hasMessage ? item.message : nullptr);
+  http->addHeader("Content-Type", "application/cbor");
+  int status = http->POST(payload, length);
+#else
+  http->addHeader("Content-Type", "application/json");
+  static char payload[448];
+  size_t length = formatEventJson(item, payload, sizeof(payload));
+  int status = http->POST((uint8_t*)payload, length);
+#endif
+
+  if (status > 0) {
+    discardHttpsBody(http);
+  }
+  releaseHttps(http, status > 0);
   if (status >= 200 && status < 300) {
-    logQueueHead = (logQueueHead + 1) % LOG_QUEUE_SIZE;
-    logQueueCount--;
+    uploadsOk++;
+    freeSlot(index);
     return true;
   }
+  uploadsFailed++;
   return false;
 }
 
 void logEvent(const char* event, bool lightsOn, int brightness, bool motion, const char* message) {
-  if (!logsConfigured()) return;
   if (!event || event[0] == '\0') return;
+  logEvent(priorityForEvent(event), event, lightsOn, brightness, motion, message);
+}
 
-  enqueueEvent(event, lightsOn, brightness, motion, message);
+void logEvent(LogPriority priority, const char* event, bool lightsOn, int brightness, bool motion,
+              const char* message) {
+  if (!event || event[0] == '\0') return;
+  flightRecordEvent(event, -1);
+  if (!logsConfigured()) return;
+
+  enqueueEvent(-1, priority, event, lightsOn, brightness, motion, message);
 }
 
 void logEvent(const char* event, bool lightsOn, int brightness, bool motion, const String& message) {
   logEvent(event, lightsOn, brightness, motion, message.c_str());
 }
+
+void logZoneEvent(uint8_t zone, const char* event, bool lightsOn, int brightness, bool motion,
+                  const char* message) {
+  if (!event || event[0] == '\0') return;
+  flightRecordEvent(event, zone);
+  if (!logsConfigured()) return;
+  if (aggregateMotion(zone, event, lightsOn, brightness, motion)) return;
+
+  enqueueEvent(zone, priorityForEvent(event), event, lightsOn, brightness, motion, message);
+}
+
+LogQueueStats getLogQueueStats() {
+  return queueStats;
+}
+
+size_t getLogQueueDepth() {
+  return logQueueCount;
+}
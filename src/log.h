@@ -1,8 +1,16 @@
 #pragma once
 #include <Arduino.h>
 
+// Decides which queued events survive when the upload queue is full.
+enum class LogPriority : uint8_t { Low, Normal, Critical };
+static const size_t kLogPriorityCount = 3;
+
+struct LogQueueStats {
+  uint32_t enqueued[kLogPriorityCount];
+  uint32_t dropped[kLogPriorityCount];
+};
+
 void setupLog();
-void handleLog();
 
 void logPrint(const char* msg);
 void logPrint(const String& msg);
@@ -11,6 +19,13 @@ void logPrintln(const String& msg);
 void logPrintf(const char* fmt, ...);
 void logEvent(const char* event, bool lightsOn, int brightness, bool motion, const char* message = nullptr);
 void logEvent(const char* event, bool lightsOn, int brightness, bool motion, const String& message);
+// Overrides the priority derived from the event name.
+void logEvent(LogPriority priority, const char* event, bool lightsOn, int brightness, bool motion,
+              const char* message = nullptr);
+void logZoneEvent(uint8_t zone, const char* event, bool lightsOn, int brightness, bool motion,
+                  const char* message = nullptr);
+LogQueueStats getLogQueueStats();
+size_t getLogQueueDepth();
 
 #define LOG_PRINT(x) logPrint(x)
 #define LOG_PRINTLN(x) logPrintln(x)
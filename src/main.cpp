@@ -1,31 +1,47 @@
 #include <Arduino.h>
 #include "wifi_ota.h"
+#include "ota_update.h"
+#include "flight_recorder.h"
+#include "heap_monitor.h"
 #include "leds.h"
 #include "pir.h"
 #include "mqtt_client.h"
+#include "peer.h"
 #include "log.h"
 #include "schedule.h"
+#include "tls_pool.h"
+#include "scheduler.h"
+#include "zones.h"
 #include <WiFi.h>
 #include <esp_system.h>
 
-// Motion timeout (ms)
-unsigned long lastMotionTime = 0;
-static const unsigned long kMotionTimeoutMs = 30000;
+static const uint32_t kControlIntervalMs = 50;
+
+static void controlTick();
 
 void setup() {
   Serial.begin(115200);
   LOG_PRINTLN("\nNachtlicht startet...");
 
+  esp_reset_reason_t reason = esp_reset_reason();
+  bool abnormalReset = reason == ESP_RST_PANIC || reason == ESP_RST_INT_WDT ||
+                       reason == ESP_RST_TASK_WDT || reason == ESP_RST_WDT;
+  setupFlightRecorder(abnormalReset);
+
   setupWiFi();
+  setupTlsPool();
   setupLog();
   setupOTA();
+  setupCompressedOta();
   setupMQTT();
+  setupZones();
+  setupPeers();
   setupPIR();
   setupLEDs();
   setupSchedule();
+  setupHeapMonitor();
 
   const char* resetReason = "unknown";
-  esp_reset_reason_t reason = esp_reset_reason();
   switch (reason) {
     case ESP_RST_POWERON: resetReason = "power_on"; break;
     case ESP_RST_SW: resetReason = "software_reset"; break;
@@ -39,66 +55,38 @@ void setup() {
     default: resetReason = "unknown"; break;
   }
   logEvent("reset_reason", isLightOn(), getCurrentBrightness(), getMotionState(), resetReason);
+  if (hasCrashRecord()) {
+    char report[128];
+    formatCrashSummary(report, sizeof(report));
+    LOG_PRINTF("Crash: %s\n", report);
+    logEvent("crash_report", isLightOn(), getCurrentBrightness(), getMotionState(), report);
+    formatCrashEvents(report, sizeof(report));
+    logEvent("crash_events", isLightOn(), getCurrentBrightness(), getMotionState(), report);
+  }
+
+  addPeriodicTask("control", controlTick, kControlIntervalMs, PRIO_HIGH);
 
   LOG_PRINTLN("Setup fertig!");
   logEvent("boot", isLightOn(), getCurrentBrightness(), getMotionState(), "setup_complete");
 }
 
 void loop() {
-  handleOTA();
-  handleMQTT();
-  handleLog();
-  handleSchedule();
+  runScheduler();
+}
 
+static void controlTick() {
   static bool lastWiFiConnected = false;
   bool wifiConnected = (WiFi.status() == WL_CONNECTED);
   if (wifiConnected != lastWiFiConnected) {
     if (wifiConnected) {
-      logEvent("wifi_reconnect", isLightOn(), getCurrentBrightness(), getMotionState(),
-               WiFi.localIP().toString());
+      char ip[16];
+      formatLocalIP(ip, sizeof(ip));
+      logEvent("wifi_reconnect", isLightOn(), getCurrentBrightness(), getMotionState(), ip);
     } else {
       logEvent("wifi_disconnect", isLightOn(), getCurrentBrightness(), getMotionState(), nullptr);
     }
     lastWiFiConnected = wifiConnected;
   }
 
-  static bool lastMotionState = false;
-  static ScheduleState lastScheduleState = ScheduleState::Unknown;
-  ScheduleState scheduleState = getScheduleState();
-  bool allowMotion = (scheduleState != ScheduleState::Blocked);
-  bool motionDetected = allowMotion ? isMotionDetected() : false;
-
-  if (motionDetected != lastMotionState) {
-    logEvent(motionDetected ? "motion_on" : "motion_off",
-             isLightOn(),
-             getCurrentBrightness(),
-             motionDetected,
-             nullptr);
-    lastMotionState = motionDetected;
-  }
-
-  if (scheduleState == ScheduleState::Blocked) {
-    if (scheduleState != lastScheduleState && isLightOn()) {
-      startFadeOut();
-      logEvent("auto_off", isLightOn(), getCurrentBrightness(), motionDetected, "schedule_blocked");
-    }
-  } else if (motionDetected) {
-    lastMotionTime = millis();
-
-    if (!isLightOn()) {
-      startFadeIn();
-      logEvent("auto_on", true, getCurrentBrightness(), motionDetected, "motion");
-    }
-  }
-  lastScheduleState = scheduleState;
-
-  updateFade();
-
-  if (isLightOn() && allowMotion && (millis() - lastMotionTime > kMotionTimeoutMs)) {
-    startFadeOut();
-  }
-
-  publishStatus(false, isLightOn(), getCurrentBrightness(), motionDetected);
-
-  delay(50);
+  updateZones();
 }
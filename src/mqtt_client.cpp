@@ -1,6 +1,13 @@
 #include "mqtt_client.h"
+#include "effects.h"
 #include "leds.h"
+#include "log.h"
+#include "ota_update.h"
 #include "pir.h"
+#include "scheduler.h"
+#include "telemetry.h"
+#include "tls_pool.h"
+#include "zones.h"
 #include <Arduino.h>
 #include <PubSubClient.h>
 #include <WiFi.h>
@@ -22,71 +29,148 @@
 #define MQTT_PASS ""
 #endif
 
-#ifndef MQTT_STATUS_TOPIC
-#define MQTT_STATUS_TOPIC "raillamp/status"
+// Topics are per device: raillamp/<efuse-id>/status/<zone>, .../effect, .../ota
+#ifndef MQTT_TOPIC_PREFIX
+#define MQTT_TOPIC_PREFIX "raillamp"
 #endif
 
 static WiFiClientSecure secureClient;
 static PubSubClient mqtt(secureClient);
 
-static unsigned long lastConnectAttemptMs = 0;
-static unsigned long lastPublishMs = 0;
-
-static bool lastLightsOn = false;
-static int lastBrightness = -1;
-static bool lastMotion = false;
+static const uint32_t kReconnectIntervalMs = 5000;
+static const uint32_t kHeartbeatIntervalMs = 5000;
+
+static char deviceId[12];
+static char effectTopic[48];
+static char otaTopic[48];
+
+// A zone that was never published always gets its first status out.
+static bool published[MAX_ZONES];
+static bool lastLightsOn[MAX_ZONES];
+static int lastBrightness[MAX_ZONES];
+static bool lastMotion[MAX_ZONES];
+static MqttStats mqttStats;
+
+static void onMessage(char* topic, uint8_t* payload, unsigned int length) {
+  if (strcmp(topic, otaTopic) == 0) {
+    // Payload is the URL of a container built with tools/pack_ota.py. A cut
+    // URL could still match OTA_URL_PREFIX, so oversized ones are dropped.
+    char otaUrl[160];
+    if (length >= sizeof(otaUrl)) {
+      LOG_PRINTF("OTA URL zu lang (%u Bytes), ignoriert\n", (unsigned)length);
+      return;
+    }
+    memcpy(otaUrl, payload, length);
+    otaUrl[length] = '\0';
+    startCompressedOta(otaUrl);
+    return;
+  }
+  if (strcmp(topic, effectTopic) != 0) return;
+  char name[16];
+  size_t len = length < sizeof(name) - 1 ? length : sizeof(name) - 1;
+  memcpy(name, payload, len);
+  name[len] = '\0';
+  if (setEffect(name)) {
+    LOG_PRINTF("Effekt: %s\n", name);
+    logEvent("effect_change", isLightOn(), getCurrentBrightness(), getMotionState(), name);
+  }
+}
 
 static void addClientConfig() {
   secureClient.setInsecure();
   mqtt.setServer(MQTT_HOST, MQTT_PORT);
   mqtt.setKeepAlive(30);
   mqtt.setSocketTimeout(5);
+  mqtt.setCallback(onMessage);
 }
 
 static bool connectMQTT() {
-  String clientId = "raillamp-" + String((uint32_t)ESP.getEfuseMac(), HEX);
+  if (!reserveTlsHandshake()) return false;
+  char clientId[24];
+  snprintf(clientId, sizeof(clientId), "raillamp-%s", deviceId);
   if (strlen(MQTT_USER) > 0) {
-    return mqtt.connect(clientId.c_str(), MQTT_USER, MQTT_PASS);
+    return mqtt.connect(clientId, MQTT_USER, MQTT_PASS);
   }
-  return mqtt.connect(clientId.c_str());
+  return mqtt.connect(clientId);
 }
 
-void setupMQTT() {
-  addClientConfig();
+// Status changes are published from here rather than from the control
+// task, which has to stay allocation-free (see HEAP_DEBUG).
+static void handleMQTT() {
+  if (!mqtt.connected()) return;
+  mqtt.loop();
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    ZoneStatus status = getZoneStatus(z);
+    publishStatus(false, z, status.lightsOn, status.brightness, status.motion);
+  }
 }
 
-void handleMQTT() {
-  if (mqtt.connected()) {
-    mqtt.loop();
-    return;
+static void publishHeartbeat() {
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    ZoneStatus status = getZoneStatus(z);
+    publishStatus(true, z, status.lightsOn, status.brightness, status.motion);
   }
+}
 
-  unsigned long now = millis();
-  if (now - lastConnectAttemptMs < 5000) return;
-  lastConnectAttemptMs = now;
-
+static void reconnectMQTT() {
+  if (mqtt.connected()) return;
   if (connectMQTT()) {
-    publishStatus(true, isLightOn(), getCurrentBrightness(), getMotionState());
+    mqttStats.connects++;
+    mqtt.subscribe(effectTopic);
+    mqtt.subscribe(otaTopic);
+    publishHeartbeat();
   }
 }
 
-void publishStatus(bool force, bool lightsOn, int brightness, bool motion) {
-  if (!mqtt.connected()) return;
+void setupMQTT() {
+  snprintf(deviceId, sizeof(deviceId), "%x", (unsigned)(uint32_t)ESP.getEfuseMac());
+  snprintf(effectTopic, sizeof(effectTopic), "%s/%s/effect", MQTT_TOPIC_PREFIX, deviceId);
+  snprintf(otaTopic, sizeof(otaTopic), "%s/%s/ota", MQTT_TOPIC_PREFIX, deviceId);
+  addClientConfig();
+  // TLS record handling inside WiFiClientSecure may allocate.
+  allowTaskAllocations(addPeriodicTask("mqtt", handleMQTT, 50, PRIO_NORMAL));
+  allowTaskAllocations(addPeriodicTask("mqtt_connect", reconnectMQTT, kReconnectIntervalMs, PRIO_LOW));
+  allowTaskAllocations(addPeriodicTask("mqtt_status", publishHeartbeat, kHeartbeatIntervalMs, PRIO_LOW));
+}
 
-  unsigned long now = millis();
-  bool changed = (lightsOn != lastLightsOn) || (brightness != lastBrightness) || (motion != lastMotion);
-  if (!force && !changed && (now - lastPublishMs < 5000)) return;
+void publishStatus(bool force, uint8_t zone, bool lightsOn, int brightness, bool motion) {
+  if (!mqtt.connected()) return;
+  if (zone >= MAX_ZONES) return;
+
+  bool changed = !published[zone] || (lightsOn != lastLightsOn[zone]) ||
+                 (brightness != lastBrightness[zone]) || (motion != lastMotion[zone]);
+  if (!force && !changed) return;
+
+  char topic[64];
+  snprintf(topic, sizeof(topic), "%s/%s/status/%u", MQTT_TOPIC_PREFIX, deviceId, (unsigned)zone);
+
+#if TELEMETRY_CBOR
+  uint8_t payload[16];
+  size_t length = encodeStatusCbor(payload, sizeof(payload), lightsOn, brightness, motion);
+  if (length == 0) return;
+  bool ok = mqtt.publish(topic, payload, length, true);
+#else
+  char json[64];
+  snprintf(json, sizeof(json), "{\"lightsOn\":%s,\"brightness\":%d,\"motion\":%s}",
+           lightsOn ? "true" : "false", brightness, motion ? "true" : "false");
+  bool ok = mqtt.publish(topic, json, true);
+#endif
+  if (ok) {
+    mqttStats.published++;
+  } else {
+    mqttStats.publishFailed++;
+  }
 
-  String json = "{";
-  json += "\"lightsOn\":" + String(lightsOn ? "true" : "false") + ",";
-  json += "\"brightness\":" + String(brightness) + ",";
-  json += "\"motion\":" + String(motion ? "true" : "false");
-  json += "}";
+  published[zone] = true;
+  lastLightsOn[zone] = lightsOn;
+  lastBrightness[zone] = brightness;
+  lastMotion[zone] = motion;
+}
 
-  mqtt.publish(MQTT_STATUS_TOPIC, json.c_str(), true);
+const char* getDeviceId() {
+  return deviceId;
+}
 
-  lastLightsOn = lightsOn;
-  lastBrightness = brightness;
-  lastMotion = motion;
-  lastPublishMs = now;
+MqttStats getMqttStats() {
+  return mqttStats;
 }
@@ -1,5 +1,14 @@
 #pragma once
+#include <stdint.h>
+
+struct MqttStats {
+  uint32_t published;
+  uint32_t publishFailed;
+  uint32_t connects;
+};
 
 void setupMQTT();
-void handleMQTT();
-void publishStatus(bool force, bool lightsOn, int brightness, bool motion);
+void publishStatus(bool force, uint8_t zone, bool lightsOn, int brightness, bool motion);
+// Lower 32 bits of the efuse MAC in hex, as used in client id and topics.
+const char* getDeviceId();
+MqttStats getMqttStats();
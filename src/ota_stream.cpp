@@ -0,0 +1,251 @@
+#include "ota_stream.h"
+#include <string.h>
+
+static uint32_t readLe32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void writeLe32(uint8_t* p, uint32_t value) {
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)(value >> 8);
+  p[2] = (uint8_t)(value >> 16);
+  p[3] = (uint8_t)(value >> 24);
+}
+
+bool parseOtaHeader(const uint8_t* data, size_t len, OtaImageHeader& header) {
+  if (len < OTA_HEADER_SIZE) return false;
+  if (memcmp(data, "RLO2", 4) != 0) return false;
+  // Must stay 0 so encodeOtaSignedHeader() gives back the signed bytes.
+  if (data[18] != 0 || data[19] != 0) return false;
+  header.rawSize = readLe32(data + 4);
+  header.blockSize = readLe32(data + 8);
+  header.blockCount = readLe32(data + 12);
+  header.windowBits = data[16];
+  header.lookaheadBits = data[17];
+  memcpy(header.sha256, data + 20, sizeof(header.sha256));
+  memcpy(header.signature, data + OTA_SIGNED_HEADER_SIZE, sizeof(header.signature));
+
+  if (header.blockSize == 0 || header.rawSize == 0) return false;
+  if (header.blockCount != (header.rawSize + header.blockSize - 1) / header.blockSize) return false;
+  if (header.windowBits < OTA_MIN_WINDOW_BITS || header.windowBits > OTA_MAX_WINDOW_BITS) return false;
+  if (header.lookaheadBits < 3 || header.lookaheadBits >= header.windowBits) return false;
+  return true;
+}
+
+void encodeOtaSignedHeader(const OtaImageHeader& header, uint8_t* out) {
+  memcpy(out, "RLO2", 4);
+  writeLe32(out + 4, header.rawSize);
+  writeLe32(out + 8, header.blockSize);
+  writeLe32(out + 12, header.blockCount);
+  out[16] = header.windowBits;
+  out[17] = header.lookaheadBits;
+  out[18] = 0;
+  out[19] = 0;
+  memcpy(out + 20, header.sha256, sizeof(header.sha256));
+}
+
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  // Bitwise CRC-32 (IEEE, as zlib.crc32); table-free to keep RAM flat.
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+  }
+  return ~crc;
+}
+
+bool HeatshrinkDecoder::reset(uint8_t windowBits, uint8_t lookaheadBits) {
+  if (windowBits < OTA_MIN_WINDOW_BITS || windowBits > OTA_MAX_WINDOW_BITS) return false;
+  if (lookaheadBits == 0 || lookaheadBits >= windowBits) return false;
+  windowBits_ = windowBits;
+  lookaheadBits_ = lookaheadBits;
+  mask_ = (uint16_t)((1u << windowBits) - 1);
+  head_ = 0;
+  // heatshrink starts from an all-zero history.
+  memset(window_, 0, sizeof(window_));
+  startField(State::Tag, 1);
+  return true;
+}
+
+void HeatshrinkDecoder::startField(State state, uint8_t bits) {
+  state_ = state;
+  bitsLeft_ = bits;
+  value_ = 0;
+}
+
+void HeatshrinkDecoder::decode(const uint8_t* data, size_t len, EmitFn emit, void* context) {
+  for (size_t i = 0; i < len; i++) {
+    uint8_t byte = data[i];
+    for (int bit = 7; bit >= 0; bit--) {
+      value_ = (uint16_t)((value_ << 1) | ((byte >> bit) & 1));
+      if (--bitsLeft_ > 0) continue;
+
+      switch (state_) {
+        case State::Tag:
+          if (value_) {
+            startField(State::Literal, 8);
+          } else {
+            startField(State::Index, windowBits_);
+          }
+          break;
+        case State::Literal: {
+          uint8_t c = (uint8_t)value_;
+          window_[head_++ & mask_] = c;
+          emit(context, c);
+          startField(State::Tag, 1);
+          break;
+        }
+        case State::Index:
+          index_ = value_ + 1;
+          startField(State::Count, lookaheadBits_);
+          break;
+        case State::Count: {
+          uint16_t count = value_ + 1;
+          for (uint16_t n = 0; n < count; n++) {
+            uint8_t c = window_[(uint16_t)(head_ - index_) & mask_];
+            window_[head_++ & mask_] = c;
+            emit(context, c);
+          }
+          startField(State::Tag, 1);
+          break;
+        }
+      }
+    }
+  }
+}
+
+void OtaStreamParser::begin() {
+  state_ = State::Header;
+  fieldLen_ = 0;
+  streamOffset_ = 0;
+  block_ = 0;
+  stagingLen_ = 0;
+  error_ = nullptr;
+}
+
+bool OtaStreamParser::resume(const OtaImageHeader& header, uint32_t block, uint32_t streamOffset) {
+  begin();
+  header_ = header;
+  block_ = block;
+  streamOffset_ = streamOffset;
+  if (block >= header.blockCount) return false;
+  if (!sink_.begin(header_)) return false;
+  state_ = State::BlockHeader;
+  return true;
+}
+
+uint32_t OtaStreamParser::blockRawSize() const {
+  uint32_t start = block_ * header_.blockSize;
+  uint32_t left = header_.rawSize - start;
+  return left < header_.blockSize ? left : header_.blockSize;
+}
+
+OtaStreamResult OtaStreamParser::fail(const char* reason) {
+  state_ = State::Error;
+  error_ = reason;
+  return OtaStreamResult::Error;
+}
+
+void OtaStreamParser::emitThunk(void* context, uint8_t value) {
+  static_cast<OtaStreamParser*>(context)->emit(value);
+}
+
+void OtaStreamParser::emit(uint8_t value) {
+  if (overrun_) return;
+  if (blockWritten_ + stagingLen_ >= blockRawSize()) {
+    overrun_ = true;
+    return;
+  }
+  staging_[stagingLen_++] = value;
+  if (stagingLen_ == sizeof(staging_)) {
+    flush();
+  }
+}
+
+bool OtaStreamParser::flush() {
+  if (stagingLen_ == 0) return true;
+  uint32_t offset = block_ * header_.blockSize + blockWritten_;
+  crc_ = crc32Update(crc_, staging_, stagingLen_);
+  bool ok = sink_.write(offset, staging_, stagingLen_);
+  blockWritten_ += stagingLen_;
+  stagingLen_ = 0;
+  if (!ok) {
+    overrun_ = true;
+  }
+  return ok;
+}
+
+bool OtaStreamParser::startBlock() {
+  compressedLeft_ = readLe32(fieldBuf_);
+  expectedCrc_ = readLe32(fieldBuf_ + 4);
+  crc_ = 0;
+  blockWritten_ = 0;
+  stagingLen_ = 0;
+  overrun_ = false;
+  return decoder_.reset(header_.windowBits, header_.lookaheadBits);
+}
+
+bool OtaStreamParser::finishBlock() {
+  if (!flush() || overrun_) return false;
+  if (blockWritten_ != blockRawSize() || crc_ != expectedCrc_) return false;
+  block_++;
+  return sink_.blockDone(block_, streamOffset_);
+}
+
+OtaStreamResult OtaStreamParser::feed(const uint8_t* data, size_t len) {
+  while (len > 0) {
+    switch (state_) {
+      case State::Done:
+        return OtaStreamResult::Done;
+      case State::Error:
+        return OtaStreamResult::Error;
+
+      case State::Header:
+      case State::BlockHeader: {
+        size_t need = (state_ == State::Header ? OTA_HEADER_SIZE : OTA_BLOCK_HEADER_SIZE) - fieldLen_;
+        size_t take = len < need ? len : need;
+        memcpy(fieldBuf_ + fieldLen_, data, take);
+        fieldLen_ += take;
+        data += take;
+        len -= take;
+        streamOffset_ += take;
+        if (take < need) break;
+        fieldLen_ = 0;
+
+        if (state_ == State::Header) {
+          if (!parseOtaHeader(fieldBuf_, OTA_HEADER_SIZE, header_)) return fail("header");
+          if (!sink_.begin(header_)) return fail("begin");
+          state_ = State::BlockHeader;
+        } else {
+          if (!startBlock()) return fail("block_header");
+          state_ = State::BlockData;
+          if (compressedLeft_ == 0 && !finishBlock()) return fail("block_crc");
+          if (compressedLeft_ == 0) {
+            state_ = block_ >= header_.blockCount ? State::Done : State::BlockHeader;
+          }
+        }
+        break;
+      }
+
+      case State::BlockData: {
+        size_t take = len < compressedLeft_ ? len : compressedLeft_;
+        decoder_.decode(data, take, emitThunk, this);
+        if (overrun_) return fail("block_data");
+        data += take;
+        len -= take;
+        streamOffset_ += take;
+        compressedLeft_ -= take;
+        if (compressedLeft_ > 0) break;
+
+        if (!finishBlock()) return fail("block_crc");
+        state_ = block_ >= header_.blockCount ? State::Done : State::BlockHeader;
+        break;
+      }
+    }
+  }
+  if (state_ == State::Done) return OtaStreamResult::Done;
+  if (state_ == State::Error) return OtaStreamResult::Error;
+  return OtaStreamResult::NeedMore;
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Compressed OTA container, written by tools/pack_ota.py. All integers are
+// little-endian.
+//
+//   header: "RLO2", u32 rawSize, u32 blockSize, u32 blockCount,
+//           u8 windowBits, u8 lookaheadBits, u16 reserved (0), u8 sha256[32],
+//           u8 signature[64]
+//   block:  u32 compressedSize, u32 crc32 of the raw block, compressed data
+//
+// sha256 covers the raw image. signature is ECDSA P-256 (r || s, big-endian)
+// over the SHA-256 of the header bytes before it; the parser only carries
+// it, checking it is up to the sink (see ota_update.cpp).
+//
+// Every block is heatshrink (LZSS) compressed on its own, so a download can
+// resume at any block boundary with a fresh decoder. This file has no
+// Arduino dependencies and builds on the host as well.
+
+#define OTA_SIGNED_HEADER_SIZE 52
+#define OTA_SIGNATURE_SIZE 64
+#define OTA_HEADER_SIZE (OTA_SIGNED_HEADER_SIZE + OTA_SIGNATURE_SIZE)
+#define OTA_BLOCK_HEADER_SIZE 8
+#define OTA_MIN_WINDOW_BITS 4
+#define OTA_MAX_WINDOW_BITS 11
+#define OTA_STAGING_SIZE 256
+
+struct OtaImageHeader {
+  uint32_t rawSize;
+  uint32_t blockSize;
+  uint32_t blockCount;
+  uint8_t windowBits;
+  uint8_t lookaheadBits;
+  uint8_t sha256[32];
+  uint8_t signature[OTA_SIGNATURE_SIZE];
+};
+
+bool parseOtaHeader(const uint8_t* data, size_t len, OtaImageHeader& header);
+// Writes the OTA_SIGNED_HEADER_SIZE bytes the signature was made over.
+void encodeOtaSignedHeader(const OtaImageHeader& header, uint8_t* out);
+uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len);
+
+// Streaming heatshrink decoder with a fixed 2^windowBits history buffer.
+// Input may be split at any byte; output goes to emit() one byte at a time.
+class HeatshrinkDecoder {
+ public:
+  typedef void (*EmitFn)(void* context, uint8_t value);
+
+  bool reset(uint8_t windowBits, uint8_t lookaheadBits);
+  void decode(const uint8_t* data, size_t len, EmitFn emit, void* context);
+
+ private:
+  enum class State : uint8_t { Tag, Literal, Index, Count };
+
+  void startField(State state, uint8_t bits);
+
+  uint8_t window_[1 << OTA_MAX_WINDOW_BITS];
+  uint16_t head_ = 0;
+  uint16_t mask_ = 0;
+  uint8_t windowBits_ = 0;
+  uint8_t lookaheadBits_ = 0;
+  State state_ = State::Tag;
+  uint8_t bitsLeft_ = 0;
+  uint16_t value_ = 0;
+  uint16_t index_ = 0;
+};
+
+// Receives the decoded image. Returning false from any call aborts the update.
+class OtaSink {
+ public:
+  virtual ~OtaSink() {}
+  virtual bool begin(const OtaImageHeader& header) = 0;
+  virtual bool write(uint32_t offset, const uint8_t* data, size_t len) = 0;
+  // Block was written and its CRC matched; a resume may start at
+  // nextBlock / nextStreamOffset from now on.
+  virtual bool blockDone(uint32_t nextBlock, uint32_t nextStreamOffset) = 0;
+};
+
+enum class OtaStreamResult : uint8_t { NeedMore, Done, Error };
+
+class OtaStreamParser {
+ public:
+  explicit OtaStreamParser(OtaSink& sink) : sink_(sink) {}
+
+  // Starts at byte 0 of the container.
+  void begin();
+  // Continues at a block boundary reported earlier through blockDone().
+  bool resume(const OtaImageHeader& header, uint32_t block, uint32_t streamOffset);
+  OtaStreamResult feed(const uint8_t* data, size_t len);
+
+  uint32_t streamOffset() const { return streamOffset_; }
+  uint32_t block() const { return block_; }
+  const char* error() const { return error_; }
+
+ private:
+  enum class State : uint8_t { Header, BlockHeader, BlockData, Done, Error };
+
+  static void emitThunk(void* context, uint8_t value);
+  void emit(uint8_t value);
+  bool flush();
+  bool finishBlock();
+  bool startBlock();
+  OtaStreamResult fail(const char* reason);
+  uint32_t blockRawSize() const;
+
+  OtaSink& sink_;
+  HeatshrinkDecoder decoder_;
+  OtaImageHeader header_ = {};
+  State state_ = State::Header;
+  uint8_t fieldBuf_[OTA_HEADER_SIZE];
+  size_t fieldLen_ = 0;
+  uint32_t streamOffset_ = 0;
+  uint32_t block_ = 0;
+  uint32_t compressedLeft_ = 0;
+  uint32_t expectedCrc_ = 0;
+  uint32_t crc_ = 0;
+  uint32_t blockWritten_ = 0;
+  bool overrun_ = false;
+  uint8_t staging_[OTA_STAGING_SIZE];
+  size_t stagingLen_ = 0;
+  const char* error_ = nullptr;
+};
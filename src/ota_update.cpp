@@ -0,0 +1,423 @@
+#include "ota_update.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <mbedtls/ecdsa.h>
+#include <mbedtls/sha256.h>
+#include "leds.h"
+#include "log.h"
+#include "ota_stream.h"
+#include "pir.h"
+#include "scheduler.h"
+#include "tls_pool.h"
+
+#ifndef OTA_PULL_CHUNK_BYTES
+#define OTA_PULL_CHUNK_BYTES 1024
+#endif
+
+#ifndef OTA_PULL_INTERVAL_MS
+#define OTA_PULL_INTERVAL_MS 5
+#endif
+
+#ifndef OTA_PULL_RETRY_MS
+#define OTA_PULL_RETRY_MS 10000
+#endif
+
+#ifndef OTA_PULL_HTTP_TIMEOUT_MS
+#define OTA_PULL_HTTP_TIMEOUT_MS 5000
+#endif
+
+#ifndef OTA_PULL_MAX_FAILURES
+#define OTA_PULL_MAX_FAILURES 20
+#endif
+
+// Uncompressed P-256 public key (65 bytes as hex, starting with 04) that
+// containers must be signed with; tools/pack_ota.py --print-pubkey prints
+// it. Without a key every pull update is refused.
+#ifndef OTA_SIGNING_PUBKEY
+#define OTA_SIGNING_PUBKEY ""
+#endif
+
+// Pull updates are only fetched from URLs starting with this prefix.
+#ifndef OTA_URL_PREFIX
+#define OTA_URL_PREFIX "https://"
+#endif
+
+// PEM root CA for the OTA host. Unset, the TLS pool does not check the
+// server certificate and only the signature protects the image.
+#ifndef OTA_CA_CERT
+#define OTA_CA_CERT nullptr
+#endif
+
+#define OTA_SECTOR_SIZE 4096
+#define OTA_ERASED_UNSET 0xFFFFFFFFu
+
+// Writes decoded blocks straight into the inactive OTA partition and
+// remembers every verified block in NVS so a reboot can resume.
+class FlashSink : public OtaSink {
+ public:
+  bool begin(const OtaImageHeader& header) override;
+  bool write(uint32_t offset, const uint8_t* data, size_t len) override;
+  bool blockDone(uint32_t nextBlock, uint32_t nextStreamOffset) override;
+
+  const esp_partition_t* partition = nullptr;
+  OtaImageHeader header = {};
+  // Set when begin() refused the image because it is already running.
+  bool alreadyApplied = false;
+  // Set when begin() refused the image because its signature did not verify.
+  bool badSignature = false;
+
+ private:
+  uint32_t erasedEnd_ = OTA_ERASED_UNSET;
+  uint8_t lastDecile_ = 0;
+};
+
+static Preferences prefs;
+static FlashSink sink;
+static OtaStreamParser parser(sink);
+static HTTPClient* http = nullptr;
+static bool active = false;
+static bool restartPending = false;
+static uint8_t failures = 0;
+static char url[160];
+static int taskId = -1;
+static uint8_t chunk[OTA_PULL_CHUNK_BYTES];
+// SHA-256 of the container the running firmware came from. A retained OTA
+// message is delivered again after every reconnect; this keeps the lamp
+// from flashing the same image over and over.
+static uint8_t appliedSha256[32];
+static bool hasApplied = false;
+
+static bool hexToBytes(const char* hex, uint8_t* out, size_t len) {
+  if (strlen(hex) != len * 2) return false;
+  for (size_t i = 0; i < len; i++) {
+    char byte[3] = {hex[2 * i], hex[2 * i + 1], '\0'};
+    char* end;
+    out[i] = (uint8_t)strtoul(byte, &end, 16);
+    if (*end != '\0') return false;
+  }
+  return true;
+}
+
+// The header signature covers the image SHA-256, which verifyImage() checks
+// against the flashed partition.
+static bool verifySignature(const OtaImageHeader& header) {
+  uint8_t key[65];
+  if (!hexToBytes(OTA_SIGNING_PUBKEY, key, sizeof(key))) return false;
+
+  uint8_t signedHeader[OTA_SIGNED_HEADER_SIZE];
+  encodeOtaSignedHeader(header, signedHeader);
+  mbedtls_sha256_context sha;
+  mbedtls_sha256_init(&sha);
+  mbedtls_sha256_starts(&sha, 0);
+  mbedtls_sha256_update(&sha, signedHeader, sizeof(signedHeader));
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&sha, digest);
+  mbedtls_sha256_free(&sha);
+
+  mbedtls_ecp_group group;
+  mbedtls_ecp_point point;
+  mbedtls_mpi r, s;
+  mbedtls_ecp_group_init(&group);
+  mbedtls_ecp_point_init(&point);
+  mbedtls_mpi_init(&r);
+  mbedtls_mpi_init(&s);
+  bool ok = mbedtls_ecp_group_load(&group, MBEDTLS_ECP_DP_SECP256R1) == 0 &&
+            mbedtls_ecp_point_read_binary(&group, &point, key, sizeof(key)) == 0 &&
+            mbedtls_mpi_read_binary(&r, header.signature, 32) == 0 &&
+            mbedtls_mpi_read_binary(&s, header.signature + 32, 32) == 0 &&
+            mbedtls_ecdsa_verify(&group, digest, sizeof(digest), &point, &r, &s) == 0;
+  mbedtls_mpi_free(&s);
+  mbedtls_mpi_free(&r);
+  mbedtls_ecp_point_free(&point);
+  mbedtls_ecp_group_free(&group);
+  return ok;
+}
+
+bool FlashSink::begin(const OtaImageHeader& imageHeader) {
+  alreadyApplied = hasApplied && memcmp(imageHeader.sha256, appliedSha256, sizeof(appliedSha256)) == 0;
+  if (alreadyApplied) return false;
+  // Checked before the first sector is erased.
+  badSignature = !verifySignature(imageHeader);
+  if (badSignature) return false;
+  partition = esp_ota_get_next_update_partition(nullptr);
+  if (!partition) return false;
+  if (imageHeader.rawSize > partition->size) return false;
+  if (imageHeader.blockSize % OTA_SECTOR_SIZE != 0) return false;
+  header = imageHeader;
+  erasedEnd_ = OTA_ERASED_UNSET;
+  lastDecile_ = 0;
+  prefs.putBytes("hdr", &header, sizeof(header));
+  return true;
+}
+
+bool FlashSink::write(uint32_t offset, const uint8_t* data, size_t len) {
+  // Blocks start on sector boundaries, so the first write of a (resumed)
+  // download tells where erasing has to begin.
+  if (erasedEnd_ == OTA_ERASED_UNSET) {
+    erasedEnd_ = offset & ~(uint32_t)(OTA_SECTOR_SIZE - 1);
+  }
+  while (erasedEnd_ < offset + len) {
+    if (esp_partition_erase_range(partition, erasedEnd_, OTA_SECTOR_SIZE) != ESP_OK) return false;
+    erasedEnd_ += OTA_SECTOR_SIZE;
+  }
+  return esp_partition_write(partition, offset, data, len) == ESP_OK;
+}
+
+bool FlashSink::blockDone(uint32_t nextBlock, uint32_t nextStreamOffset) {
+  prefs.putUInt("block", nextBlock);
+  prefs.putUInt("offset", nextStreamOffset);
+  uint8_t decile = (uint8_t)((uint64_t)nextBlock * 10 / header.blockCount);
+  if (decile != lastDecile_) {
+    lastDecile_ = decile;
+    LOG_PRINTF("OTA Download: %u%%\n", decile * 10);
+  }
+  return true;
+}
+
+static void clearState() {
+  prefs.remove("url");
+  prefs.remove("hdr");
+  prefs.remove("block");
+  prefs.remove("offset");
+}
+
+static void closeStream(bool keepAlive) {
+  if (!http) return;
+  releaseHttps(http, keepAlive);
+  http = nullptr;
+}
+
+static void abortUpdate(const char* reason) {
+  closeStream(false);
+  clearState();
+  active = false;
+  LOG_PRINTF("OTA abgebrochen: %s\n", reason);
+  char message[48];
+  snprintf(message, sizeof(message), "pull:%s", reason);
+  logEvent("ota_error", isLightOn(), getCurrentBrightness(), getMotionState(), message);
+}
+
+static void skipUpdate() {
+  closeStream(false);
+  clearState();
+  active = false;
+  LOG_PRINTLN("OTA uebersprungen: Image laeuft bereits");
+  logEvent("ota_skip", isLightOn(), getCurrentBrightness(), getMotionState(), "pull:same_image");
+}
+
+// The parser reports a refused begin() as a generic error; the sink knows why.
+static void failUpdate(const char* reason) {
+  if (sink.alreadyApplied) {
+    skipUpdate();
+  } else {
+    abortUpdate(sink.badSignature ? "signature" : reason);
+  }
+}
+
+// The image flashed last time counts as applied only once it actually
+// booted; after a rollback the same container may be retried.
+static void confirmAppliedImage() {
+  uint8_t pending[32];
+  if (prefs.getBytes("pend_sha", pending, sizeof(pending)) == sizeof(pending)) {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (running && running->address == prefs.getUInt("pend_addr", 0)) {
+      prefs.putBytes("applied", pending, sizeof(pending));
+    }
+    prefs.remove("pend_sha");
+    prefs.remove("pend_addr");
+  }
+  hasApplied = prefs.getBytes("applied", appliedSha256, sizeof(appliedSha256)) == sizeof(appliedSha256);
+}
+
+static void retryLater(const char* reason) {
+  closeStream(false);
+  if (++failures > OTA_PULL_MAX_FAILURES) {
+    abortUpdate(reason);
+    return;
+  }
+  LOG_PRINTF("OTA unterbrochen (%s), neuer Versuch ab Block %u\n", reason,
+             (unsigned)prefs.getUInt("block", 0));
+  rescheduleTask(taskId, OTA_PULL_RETRY_MS);
+}
+
+static bool verifyImage() {
+  mbedtls_sha256_context ctx;
+  mbedtls_sha256_init(&ctx);
+  mbedtls_sha256_starts(&ctx, 0);
+  uint8_t buffer[256];
+  for (uint32_t offset = 0; offset < sink.header.rawSize; offset += sizeof(buffer)) {
+    uint32_t len = sink.header.rawSize - offset;
+    if (len > sizeof(buffer)) len = sizeof(buffer);
+    if (esp_partition_read(sink.partition, offset, buffer, len) != ESP_OK) {
+      mbedtls_sha256_free(&ctx);
+      return false;
+    }
+    mbedtls_sha256_update(&ctx, buffer, len);
+  }
+  uint8_t digest[32];
+  mbedtls_sha256_finish(&ctx, digest);
+  mbedtls_sha256_free(&ctx);
+  return memcmp(digest, sink.header.sha256, sizeof(digest)) == 0;
+}
+
+static void finishUpdate() {
+  closeStream(true);
+  if (!verifySignature(sink.header)) {
+    abortUpdate("signature");
+    return;
+  }
+  if (!verifyImage()) {
+    abortUpdate("sha256");
+    return;
+  }
+  if (esp_ota_set_boot_partition(sink.partition) != ESP_OK) {
+    abortUpdate("boot_partition");
+    return;
+  }
+  clearState();
+  prefs.putBytes("pend_sha", sink.header.sha256, sizeof(sink.header.sha256));
+  prefs.putUInt("pend_addr", sink.partition->address);
+  active = false;
+  LOG_PRINTLN("OTA Pull fertig, Neustart...");
+  logEvent("ota_end", isLightOn(), getCurrentBrightness(), getMotionState(), "pull");
+  // Give the log upload a moment before restarting.
+  restartPending = true;
+  rescheduleTask(taskId, 3000);
+}
+
+static void openStream() {
+  if (WiFi.status() != WL_CONNECTED) {
+    rescheduleTask(taskId, OTA_PULL_RETRY_MS);
+    return;
+  }
+
+  OtaImageHeader header;
+  uint32_t block = prefs.getUInt("block", 0);
+  uint32_t offset = prefs.getUInt("offset", 0);
+  bool resume = block > 0 && prefs.getBytes("hdr", &header, sizeof(header)) == sizeof(header);
+  sink.alreadyApplied = false;
+  sink.badSignature = false;
+
+  http = acquireHttps(url, OTA_PULL_HTTP_TIMEOUT_MS, OTA_CA_CERT);
+  if (!http) {
+    rescheduleTask(taskId, OTA_PULL_RETRY_MS);
+    return;
+  }
+  if (resume) {
+    char range[32];
+    snprintf(range, sizeof(range), "bytes=%u-", (unsigned)offset);
+    http->addHeader("Range", range);
+  }
+
+  int status = http->GET();
+  if (resume && status == 206) {
+    if (!parser.resume(header, block, offset)) {
+      failUpdate("resume");
+      return;
+    }
+    LOG_PRINTF("OTA wird ab Block %u fortgesetzt\n", (unsigned)block);
+  } else if (status == 200) {
+    // Fresh start, or the server ignored the Range header.
+    parser.begin();
+  } else {
+    retryLater("http");
+    return;
+  }
+  rescheduleTask(taskId, OTA_PULL_INTERVAL_MS);
+}
+
+static void handleCompressedOta() {
+  if (restartPending) {
+    ESP.restart();
+    return;
+  }
+  if (!active) return;
+  if (!http) {
+    openStream();
+    return;
+  }
+
+  WiFiClient* stream = http->getStreamPtr();
+  if (!stream) {
+    retryLater("stream");
+    return;
+  }
+  int available = stream->available();
+  if (available <= 0) {
+    if (!stream->connected()) {
+      retryLater("disconnect");
+    } else {
+      rescheduleTask(taskId, OTA_PULL_INTERVAL_MS);
+    }
+    return;
+  }
+
+  size_t len = (size_t)available < sizeof(chunk) ? (size_t)available : sizeof(chunk);
+  int read = stream->read(chunk, len);
+  if (read > 0) {
+    OtaStreamResult result = parser.feed(chunk, read);
+    if (result == OtaStreamResult::Error) {
+      failUpdate(parser.error());
+      return;
+    }
+    if (result == OtaStreamResult::Done) {
+      finishUpdate();
+      return;
+    }
+    failures = 0;
+  }
+  rescheduleTask(taskId, OTA_PULL_INTERVAL_MS);
+}
+
+static bool urlAllowed(const char* candidate) {
+  if (strncmp(candidate, OTA_URL_PREFIX, strlen(OTA_URL_PREFIX)) != 0) {
+    LOG_PRINTF("OTA URL ausserhalb von %s abgelehnt\n", OTA_URL_PREFIX);
+    return false;
+  }
+  if (strlen(OTA_SIGNING_PUBKEY) == 0) {
+    LOG_PRINTLN("OTA abgelehnt: kein OTA_SIGNING_PUBKEY konfiguriert");
+    return false;
+  }
+  return true;
+}
+
+void setupCompressedOta() {
+  prefs.begin("ota", false);
+  confirmAppliedImage();
+  taskId = addOneShotTask("ota_pull", handleCompressedOta, OTA_PULL_RETRY_MS, PRIO_LOW);
+  allowTaskAllocations(taskId);
+  if (prefs.getString("url", url, sizeof(url)) > 0) {
+    if (!urlAllowed(url)) {
+      clearState();
+      url[0] = '\0';
+      return;
+    }
+    active = true;
+    LOG_PRINTF("Unterbrochenes OTA gefunden: %s\n", url);
+  }
+}
+
+bool startCompressedOta(const char* newUrl) {
+  if (!newUrl || strlen(newUrl) >= sizeof(url)) return false;
+  if (!urlAllowed(newUrl)) return false;
+  if (strcmp(newUrl, url) != 0 || !active) {
+    // A different image: forget any half-written one.
+    closeStream(false);
+    clearState();
+    strlcpy(url, newUrl, sizeof(url));
+    prefs.putString("url", url);
+  }
+  active = true;
+  failures = 0;
+  LOG_PRINTF("OTA Pull startet: %s\n", url);
+  logEvent("ota_start", isLightOn(), getCurrentBrightness(), getMotionState(), "pull");
+  rescheduleTask(taskId, 0);
+  return true;
+}
+
+bool isCompressedOtaActive() {
+  return active;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Pull update from a compressed container (see ota_stream.h), next to the
+// push-based ArduinoOTA in wifi_ota.cpp.
+void setupCompressedOta();
+// Starts downloading url. An unfinished download of the same url resumes at
+// its last verified block, also across reboots. Returns false for URLs
+// outside OTA_URL_PREFIX or when no OTA_SIGNING_PUBKEY is built in; only
+// containers signed with that key are flashed.
+bool startCompressedOta(const char* url);
+bool isCompressedOtaActive();
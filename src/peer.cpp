@@ -0,0 +1,248 @@
+#include "peer.h"
+#include <WiFi.h>
+#include <esp_system.h>
+#include <lwip/sockets.h>
+#include "log.h"
+#include "peer_protocol.h"
+#include "scheduler.h"
+#include "zones.h"
+
+// Off by default: lamps only react to peers once kPeerRules is filled in
+// and the firmware is built with -DPEER_MOTION=1.
+#ifndef PEER_MOTION
+#define PEER_MOTION 0
+#endif
+
+#ifndef PEER_MULTICAST_PORT
+#define PEER_MULTICAST_PORT 4210
+#endif
+
+// Polled fast enough that receipt-to-fade stays well below 20 ms.
+#ifndef PEER_POLL_INTERVAL_MS
+#define PEER_POLL_INTERVAL_MS 5
+#endif
+
+// How often the send task checks WiFi and (re)opens the socket.
+#ifndef PEER_LINK_CHECK_INTERVAL_MS
+#define PEER_LINK_CHECK_INTERVAL_MS 1000
+#endif
+
+// Multicast over WiFi is not acknowledged; copies are deduplicated by seq.
+#ifndef PEER_SEND_COPIES
+#define PEER_SEND_COPIES 2
+#endif
+
+#ifndef PEER_MIN_SEND_INTERVAL_MS
+#define PEER_MIN_SEND_INTERVAL_MS 1000
+#endif
+
+#ifndef PEER_MIN_TRIGGER_INTERVAL_MS
+#define PEER_MIN_TRIGGER_INTERVAL_MS 1000
+#endif
+
+#ifndef PEER_PROBE_INTERVAL_MS
+#define PEER_PROBE_INTERVAL_MS 60000
+#endif
+
+struct PeerRule {
+  uint32_t deviceId;  // efuse id as in the MQTT topic, 0 = any peer
+  uint8_t remoteZone;
+  uint8_t localZone;
+};
+
+// Add a line per neighbour zone that should pre-light a local zone. The
+// example maps zone 0 of every lamp on the LAN onto local zone 0.
+static const PeerRule kPeerRules[] = {
+  {0, 0, 0},
+};
+
+static const char* kMulticastGroup = "239.76.82.1";
+
+// Raw lwIP socket rather than WiFiUDP, whose parsePacket() allocates a
+// receive buffer on every poll. Received packets land in rxBuffer.
+static int sock = -1;
+static uint8_t rxBuffer[PEER_PACKET_SIZE];
+static int sendTaskId = -1;
+static uint32_t ownId = 0;
+static uint32_t bootId = 0;
+static uint16_t nextSeq = 0;
+static uint16_t probeSeq = 0;
+static unsigned long lastSendMs[MAX_ZONES];
+// Edge time per zone waiting to be sent by the peer task, 0 = nothing.
+static unsigned long pendingMotionMs[MAX_ZONES];
+// Probe waiting to be answered by the send task.
+static bool replyPending = false;
+static PeerPacket pendingReply;
+static sockaddr_in pendingReplyTo;
+static PeerFilter filter(PEER_MIN_TRIGGER_INTERVAL_MS);
+static PeerStats stats;
+
+static bool openSocket() {
+  int s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (s < 0) return false;
+  int reuse = 1;
+  setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(PEER_MULTICAST_PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  ip_mreq group = {};
+  group.imr_multiaddr.s_addr = inet_addr(kMulticastGroup);
+  group.imr_interface.s_addr = htonl(INADDR_ANY);
+  if (bind(s, (sockaddr*)&addr, sizeof(addr)) < 0 ||
+      setsockopt(s, IPPROTO_IP, IP_ADD_MEMBERSHIP, &group, sizeof(group)) < 0) {
+    close(s);
+    return false;
+  }
+  sock = s;
+  return true;
+}
+
+static void closeSocket() {
+  if (sock < 0) return;
+  close(sock);
+  sock = -1;
+  replyPending = false;
+}
+
+// dest nullptr sends to the multicast group.
+static void sendPacket(PeerPacketType type, uint8_t zone, uint16_t seq, uint32_t timestampMs,
+                       const sockaddr_in* dest) {
+  PeerPacket packet = {type, ownId, bootId, zone, seq, timestampMs};
+  uint8_t buffer[PEER_PACKET_SIZE];
+  if (!encodePeerPacket(packet, buffer, sizeof(buffer))) return;
+  sockaddr_in group = {};
+  if (!dest) {
+    group.sin_family = AF_INET;
+    group.sin_port = htons(PEER_MULTICAST_PORT);
+    group.sin_addr.s_addr = inet_addr(kMulticastGroup);
+    dest = &group;
+  }
+  if (sendto(sock, buffer, sizeof(buffer), 0, (const sockaddr*)dest, sizeof(*dest)) < 0) return;
+  stats.sent++;
+}
+
+static void triggerPeers(const PeerPacket& packet) {
+  switch (filter.check(packet, millis())) {
+    case PeerVerdict::Duplicate: stats.duplicates++; return;
+    case PeerVerdict::RateLimited: stats.rateLimited++; return;
+    case PeerVerdict::Accept: break;
+  }
+  for (const PeerRule& rule : kPeerRules) {
+    if (rule.deviceId != 0 && rule.deviceId != packet.deviceId) continue;
+    if (rule.remoteZone != packet.zone) continue;
+    triggerZoneFromPeer(rule.localZone);
+    stats.triggers++;
+  }
+}
+
+static void handlePacket(const PeerPacket& packet, const sockaddr_in& from) {
+  // Multicast loops back to the sender.
+  if (packet.deviceId == ownId) return;
+  stats.received++;
+
+  switch (packet.type) {
+    case PeerPacketType::Motion:
+      triggerPeers(packet);
+      break;
+    case PeerPacketType::Probe:
+      // Sending allocates in lwIP, so the reply goes out from the send task.
+      pendingReply = packet;
+      pendingReplyTo = from;
+      replyPending = true;
+      rescheduleTask(sendTaskId, 0);
+      break;
+    case PeerPacketType::Reply:
+      if (packet.seq != probeSeq) break;
+      stats.lastRttMs = millis() - packet.timestampMs;
+      if (stats.lastRttMs > stats.maxRttMs) {
+        stats.maxRttMs = stats.lastRttMs;
+      }
+      break;
+  }
+}
+
+static void sendPendingMotion() {
+  for (uint8_t zone = 0; zone < MAX_ZONES; zone++) {
+    if (pendingMotionMs[zone] == 0) continue;
+    uint16_t seq = nextSeq++;
+    for (int i = 0; i < PEER_SEND_COPIES; i++) {
+      sendPacket(PeerPacketType::Motion, zone, seq, pendingMotionMs[zone], nullptr);
+    }
+    pendingMotionMs[zone] = 0;
+  }
+}
+
+// Receives without allocating: recvfrom() copies into the static buffer.
+static void handlePeers() {
+  if (sock < 0) return;
+  // Bounded so a packet storm cannot starve the LED tasks.
+  for (int i = 0; i < 8; i++) {
+    sockaddr_in from;
+    socklen_t fromLen = sizeof(from);
+    int len = recvfrom(sock, rxBuffer, sizeof(rxBuffer), MSG_DONTWAIT, (sockaddr*)&from, &fromLen);
+    if (len <= 0) break;
+    PeerPacket packet;
+    if (decodePeerPacket(rxBuffer, len, packet)) {
+      handlePacket(packet, from);
+    }
+  }
+}
+
+// Opens and closes the socket with WiFi and sends what the control and
+// receive paths queued. Runs every PEER_LINK_CHECK_INTERVAL_MS and right
+// away when something is queued.
+static void sendPeers() {
+  if (WiFi.status() != WL_CONNECTED) {
+    closeSocket();
+    return;
+  }
+  if (sock < 0) {
+    if (!openSocket()) return;
+    LOG_PRINTF("Peers: Multicast auf Port %u\n", (unsigned)PEER_MULTICAST_PORT);
+  }
+
+  sendPendingMotion();
+  if (replyPending) {
+    replyPending = false;
+    sendPacket(PeerPacketType::Reply, pendingReply.zone, pendingReply.seq,
+               pendingReply.timestampMs, &pendingReplyTo);
+  }
+}
+
+static void probePeers() {
+  if (sock < 0) return;
+  if (stats.lastRttMs > 0) {
+    LOG_PRINTF("Peers: RTT %u ms (max %u ms), %u Trigger, %u Duplikate, %u gedrosselt\n",
+               (unsigned)stats.lastRttMs, (unsigned)stats.maxRttMs, (unsigned)stats.triggers,
+               (unsigned)stats.duplicates, (unsigned)stats.rateLimited);
+  }
+  probeSeq = nextSeq++;
+  sendPacket(PeerPacketType::Probe, 0, probeSeq, millis(), nullptr);
+}
+
+void setupPeers() {
+#if PEER_MOTION
+  ownId = (uint32_t)ESP.getEfuseMac();
+  bootId = esp_random();
+  addPeriodicTask("peer", handlePeers, PEER_POLL_INTERVAL_MS, PRIO_HIGH);
+  sendTaskId = addPeriodicTask("peer_send", sendPeers, PEER_LINK_CHECK_INTERVAL_MS, PRIO_HIGH);
+  allowTaskAllocations(sendTaskId);
+  allowTaskAllocations(addPeriodicTask("peer_probe", probePeers, PEER_PROBE_INTERVAL_MS, PRIO_LOW));
+#endif
+}
+
+void broadcastMotion(uint8_t zone) {
+  if (sock < 0 || zone >= MAX_ZONES) return;
+  unsigned long now = millis();
+  if (lastSendMs[zone] != 0 && now - lastSendMs[zone] < PEER_MIN_SEND_INTERVAL_MS) return;
+  lastSendMs[zone] = now;
+  // Sent from the send task: lwIP allocates, the control task must not.
+  pendingMotionMs[zone] = now ? now : 1;
+  rescheduleTask(sendTaskId, 0);
+}
+
+PeerStats getPeerStats() {
+  return stats;
+}
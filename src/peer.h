@@ -0,0 +1,20 @@
+#pragma once
+#include <Arduino.h>
+
+struct PeerStats {
+  uint32_t sent;
+  uint32_t received;
+  uint32_t duplicates;
+  uint32_t rateLimited;
+  uint32_t triggers;
+  uint32_t lastRttMs;
+  uint32_t maxRttMs;
+};
+
+// LAN multicast between lamps: motion in a local zone pre-lights the zones
+// that kPeerRules in peer.cpp map it to on the neighbours.
+void setupPeers();
+// Call on a rising motion edge; rate limited per zone. The packet goes out
+// from the peer send task on the next scheduler pass.
+void broadcastMotion(uint8_t zone);
+PeerStats getPeerStats();
@@ -0,0 +1,90 @@
+#include "peer_protocol.h"
+
+static void writeLe16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void writeLe32(uint8_t* out, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    out[i] = (value >> (8 * i)) & 0xFF;
+  }
+}
+
+static uint16_t readLe16(const uint8_t* data) {
+  return data[0] | (uint16_t)(data[1] << 8);
+}
+
+static uint32_t readLe32(const uint8_t* data) {
+  return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) |
+         ((uint32_t)data[3] << 24);
+}
+
+bool encodePeerPacket(const PeerPacket& packet, uint8_t* out, size_t size) {
+  if (size < PEER_PACKET_SIZE) return false;
+  out[0] = 'R';
+  out[1] = 'L';
+  out[2] = PEER_PROTOCOL_VERSION;
+  out[3] = (uint8_t)packet.type;
+  writeLe32(out + 4, packet.deviceId);
+  writeLe32(out + 8, packet.bootId);
+  out[12] = packet.zone;
+  writeLe16(out + 13, packet.seq);
+  writeLe32(out + 15, packet.timestampMs);
+  return true;
+}
+
+bool decodePeerPacket(const uint8_t* data, size_t len, PeerPacket& packet) {
+  if (len < PEER_PACKET_SIZE) return false;
+  if (data[0] != 'R' || data[1] != 'L') return false;
+  if (data[2] != PEER_PROTOCOL_VERSION) return false;
+  uint8_t type = data[3];
+  if (type < (uint8_t)PeerPacketType::Motion || type > (uint8_t)PeerPacketType::Reply) return false;
+  packet.type = (PeerPacketType)type;
+  packet.deviceId = readLe32(data + 4);
+  packet.bootId = readLe32(data + 8);
+  packet.zone = data[12];
+  packet.seq = readLe16(data + 13);
+  packet.timestampMs = readLe32(data + 15);
+  return true;
+}
+
+PeerVerdict PeerFilter::check(const PeerPacket& packet, uint32_t nowMs) {
+  uint32_t deviceId = packet.deviceId;
+  uint8_t zone = packet.zone;
+  uint16_t seq = packet.seq;
+  Slot* slot = nullptr;
+  Slot* oldest = &slots_[0];
+  for (Slot& s : slots_) {
+    if (s.used && s.deviceId == deviceId && s.zone == zone) {
+      slot = &s;
+      break;
+    }
+    if (!s.used || (oldest->used && (int32_t)(s.lastSeenMs - oldest->lastSeenMs) < 0)) {
+      oldest = &s;
+    }
+  }
+
+  // Unknown source, or a known one that rebooted and counts from 0 again.
+  if (!slot || slot->bootId != packet.bootId) {
+    if (!slot) slot = oldest;
+    slot->used = true;
+    slot->deviceId = deviceId;
+    slot->bootId = packet.bootId;
+    slot->zone = zone;
+    slot->lastSeq = seq;
+    slot->lastSeenMs = nowMs;
+    slot->lastAcceptMs = nowMs;
+    return PeerVerdict::Accept;
+  }
+
+  slot->lastSeenMs = nowMs;
+  // Not newer than the last seq: a repeat or a late copy. After a long
+  // silence any seq is taken as new, which also covers a wrapped seq.
+  bool stale = nowMs - slot->lastAcceptMs > 60000;
+  if ((int16_t)(seq - slot->lastSeq) <= 0 && !stale) return PeerVerdict::Duplicate;
+  slot->lastSeq = seq;
+  if (nowMs - slot->lastAcceptMs < minIntervalMs_) return PeerVerdict::RateLimited;
+  slot->lastAcceptMs = nowMs;
+  return PeerVerdict::Accept;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// LAN peer packet, multicast between lamps. All integers are little-endian.
+//
+//   "RL", u8 version, u8 type, u32 deviceId, u32 bootId, u8 zone, u16 seq,
+//   u32 timestampMs
+//
+// bootId is drawn at random on every boot, so receivers can tell a peer
+// that restarted (and began its seq again at 0) from a replayed packet.
+//
+// A probe is answered with a reply carrying the probe's seq and timestamp,
+// so the prober can measure the round trip on its own clock. This file has
+// no Arduino dependencies and builds on the host as well.
+
+#define PEER_PACKET_SIZE 19
+#define PEER_PROTOCOL_VERSION 2
+#define PEER_FILTER_SLOTS 8
+
+enum class PeerPacketType : uint8_t { Motion = 1, Probe = 2, Reply = 3 };
+
+struct PeerPacket {
+  PeerPacketType type;
+  uint32_t deviceId;
+  uint32_t bootId;
+  uint8_t zone;
+  uint16_t seq;
+  uint32_t timestampMs;
+};
+
+// Both return false on a short buffer or a foreign/unsupported packet.
+bool encodePeerPacket(const PeerPacket& packet, uint8_t* out, size_t size);
+bool decodePeerPacket(const uint8_t* data, size_t len, PeerPacket& packet);
+
+enum class PeerVerdict : uint8_t { Accept, Duplicate, RateLimited };
+
+// Remembers the last seq per (device, zone). Each motion packet is sent
+// more than once, so repeats are dropped; accepted triggers from one source
+// are limited to one per minIntervalMs. When the table is full the least
+// recently seen source is replaced. A new bootId resets the source.
+class PeerFilter {
+ public:
+  explicit PeerFilter(uint32_t minIntervalMs) : minIntervalMs_(minIntervalMs) {}
+  PeerVerdict check(const PeerPacket& packet, uint32_t nowMs);
+
+ private:
+  struct Slot {
+    bool used;
+    uint32_t deviceId;
+    uint32_t bootId;
+    uint8_t zone;
+    uint16_t lastSeq;
+    uint32_t lastSeenMs;
+    uint32_t lastAcceptMs;
+  };
+
+  Slot slots_[PEER_FILTER_SLOTS] = {};
+  uint32_t minIntervalMs_;
+};
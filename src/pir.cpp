@@ -1,31 +1,53 @@
 #include "pir.h"
 #include <Arduino.h>
 #include "log.h"
+#include "zones.h"
 
-#define PIR_PIN_1 13
-#define PIR_PIN_2 14
+#define PIR_UNUSED 0xFF
 
-static bool readMotionRaw() {
-  int motion1 = digitalRead(PIR_PIN_1);
-  int motion2 = digitalRead(PIR_PIN_2);
-  return (motion1 == HIGH || motion2 == HIGH);
+static bool readSensor(uint8_t pin) {
+  return pin != PIR_UNUSED && digitalRead(pin) == HIGH;
+}
+
+static bool readMotionRaw(uint8_t zone) {
+  const ZoneConfig& config = getZoneConfig(zone);
+  return readSensor(config.pirPins[0]) || readSensor(config.pirPins[1]);
 }
 
 void setupPIR() {
-  pinMode(PIR_PIN_1, INPUT);
-  pinMode(PIR_PIN_2, INPUT);
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    const ZoneConfig& config = getZoneConfig(z);
+    for (uint8_t pin : config.pirPins) {
+      if (pin != PIR_UNUSED) {
+        pinMode(pin, INPUT);
+      }
+    }
+  }
   LOG_PRINTLN("PIR Sensoren initialisiert!");
 }
 
-bool isMotionDetected() {
-  bool motion = readMotionRaw();
+bool isMotionDetected(uint8_t zone) {
+  bool motion = readMotionRaw(zone);
   if (motion) {
-    int motion1 = digitalRead(PIR_PIN_1);
-    LOG_PRINTLN("Bewegung erkannt! (Sensor " + String(motion1 == HIGH ? 1 : 2) + ")");
+    LOG_PRINTF("Bewegung erkannt! (Zone %u, Sensor %d)\n", (unsigned)zone, getTriggeredSensor(zone));
   }
   return motion;
 }
 
+int getTriggeredSensor(uint8_t zone) {
+  const ZoneConfig& config = getZoneConfig(zone);
+  if (readSensor(config.pirPins[0])) return 1;
+  if (readSensor(config.pirPins[1])) return 2;
+  return 0;
+}
+
+bool getMotionState(uint8_t zone) {
+  return readMotionRaw(zone);
+}
+
 bool getMotionState() {
-  return readMotionRaw();
+  for (size_t z = 0; z < getZoneCount(); z++) {
+    if (readMotionRaw(z)) return true;
+  }
+  return false;
 }
@@ -1,5 +1,9 @@
 #pragma once
+#include <stdint.h>
 
 void setupPIR();
-bool isMotionDetected();
+bool isMotionDetected(uint8_t zone);
+int getTriggeredSensor(uint8_t zone);
+bool getMotionState(uint8_t zone);
+// Any zone sees motion.
 bool getMotionState();
@@ -3,11 +3,12 @@
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 #include <time.h>
 #include "log.h"
 #include "leds.h"
 #include "pir.h"
+#include "scheduler.h"
+#include "tls_pool.h"
 
 static const char* kScheduleUrl = "https://railroadlantern-web.vercel.app/api/schedule";
 static const char* kTwilightUrl = "https://railroadlantern-web.vercel.app/api/twilight";
@@ -16,26 +17,31 @@ static const unsigned long kScheduleCheckIntervalMs = 30000;
 static const unsigned long kScheduleFetchRetryMs = 30000;
 static const unsigned long kHttpTimeoutMs = 10000;
 
+// "HH:MM" plus room for an optional ":SS" from the API.
+#define SCHEDULE_TIME_LEN 9
+#define SCHEDULE_TYPE_LEN 16
+#define SCHEDULE_BODY_LEN 512
+
 struct ScheduleConfig {
-  String startTime;
-  String endTime;
-  String startType;
-  String endType;
+  char startTime[SCHEDULE_TIME_LEN] = "";
+  char endTime[SCHEDULE_TIME_LEN] = "";
+  char startType[SCHEDULE_TYPE_LEN] = "";
+  char endType[SCHEDULE_TYPE_LEN] = "";
   bool enabled = false;
 };
 
 struct TwilightTimes {
-  String civilDawn;
-  String civilDusk;
+  char civilDawn[SCHEDULE_TIME_LEN] = "";
+  char civilDusk[SCHEDULE_TIME_LEN] = "";
 };
 
 static ScheduleConfig scheduleConfig;
-static String effectiveStart;
-static String effectiveEnd;
+static char effectiveStart[SCHEDULE_TIME_LEN];
+static char effectiveEnd[SCHEDULE_TIME_LEN];
+// Shared by both requests; they run one after the other.
+static char responseBody[SCHEDULE_BODY_LEN];
 static bool scheduleLoaded = false;
 static int lastFetchYday = -1;
-static unsigned long lastFetchAttemptMs = 0;
-static unsigned long lastEvalMs = 0;
 static ScheduleState cachedState = ScheduleState::Unknown;
 
 static bool timeIsValid() {
@@ -50,14 +56,15 @@ static bool getLocalTimeNow(struct tm& timeInfo) {
   return true;
 }
 
-static int timeToMinutes(const String& time) {
-  if (time.length() < 5) return -1;
-  int hours = time.substring(0, 2).toInt();
-  int minutes = time.substring(3, 5).toInt();
+static int timeToMinutes(const char* time) {
+  if (strlen(time) < 5) return -1;
+  if (!isdigit(time[0]) || !isdigit(time[1]) || !isdigit(time[3]) || !isdigit(time[4])) return -1;
+  int hours = (time[0] - '0') * 10 + (time[1] - '0');
+  int minutes = (time[3] - '0') * 10 + (time[4] - '0');
   return hours * 60 + minutes;
 }
 
-static bool shouldBeOn(const String& current, const String& start, const String& end) {
+static bool shouldBeOn(const char* current, const char* start, const char* end) {
   int currentMin = timeToMinutes(current);
   int startMin = timeToMinutes(start);
   int endMin = timeToMinutes(end);
@@ -69,25 +76,31 @@ static bool shouldBeOn(const String& current, const String& start, const String&
   return (currentMin >= startMin && currentMin < endMin);
 }
 
-static void logScheduleEvent(const char* event, const String& details) {
-  if (details.length() == 0) {
+static void logScheduleEvent(const char* event, const char* details) {
+  if (!details || details[0] == '\0') {
     logEvent(event, isLightOn(), getCurrentBrightness(), getMotionState(), nullptr);
   } else {
     logEvent(event, isLightOn(), getCurrentBrightness(), getMotionState(), details);
   }
 }
 
-static bool parseSchedule(const String& body, ScheduleConfig& config) {
-  DynamicJsonDocument doc(512);
-  DeserializationError err = deserializeJson(doc, body);
+static void copyJsonString(JsonVariant value, char* out, size_t size) {
+  if (value.is<const char*>()) {
+    strlcpy(out, value.as<const char*>(), size);
+  } else {
+    out[0] = '\0';
+  }
+}
+
+static bool parseSchedule(char* body, size_t len, ScheduleConfig& config) {
+  StaticJsonDocument<512> doc;
+  DeserializationError err = deserializeJson(doc, body, len);
   if (err) return false;
 
   // API returns nested object: {"schedule": {...}}
   JsonVariant schedule = doc["schedule"];
   if (!schedule.is<JsonObject>()) return false;
 
-  JsonVariant startTime = schedule["start_time"];
-  JsonVariant endTime = schedule["end_time"];
   JsonVariant startType = schedule["start_type"];
   JsonVariant endType = schedule["end_type"];
   JsonVariant enabled = schedule["enabled"];
@@ -95,106 +108,94 @@ static bool parseSchedule(const String& body, ScheduleConfig& config) {
   if (!startType.is<const char*>() || !endType.is<const char*>()) return false;
   if (!enabled.is<bool>()) return false;
 
-  config.startType = String(startType.as<const char*>());
-  config.endType = String(endType.as<const char*>());
+  copyJsonString(startType, config.startType, sizeof(config.startType));
+  copyJsonString(endType, config.endType, sizeof(config.endType));
   config.enabled = enabled.as<bool>();
-
-  if (startTime.is<const char*>()) {
-    config.startTime = String(startTime.as<const char*>());
-  } else {
-    config.startTime = "";
-  }
-
-  if (endTime.is<const char*>()) {
-    config.endTime = String(endTime.as<const char*>());
-  } else {
-    config.endTime = "";
-  }
-
+  copyJsonString(schedule["start_time"], config.startTime, sizeof(config.startTime));
+  copyJsonString(schedule["end_time"], config.endTime, sizeof(config.endTime));
   return true;
 }
 
-static bool parseTwilight(const String& body, TwilightTimes& twilight) {
-  DynamicJsonDocument doc(384);
-  DeserializationError err = deserializeJson(doc, body);
+static bool parseTwilight(char* body, size_t len, TwilightTimes& twilight) {
+  StaticJsonDocument<384> doc;
+  DeserializationError err = deserializeJson(doc, body, len);
   if (err) return false;
 
   JsonVariant civilDawn = doc["civil_dawn"];
   JsonVariant civilDusk = doc["civil_dusk"];
   if (!civilDawn.is<const char*>() || !civilDusk.is<const char*>()) return false;
 
-  twilight.civilDawn = String(civilDawn.as<const char*>());
-  twilight.civilDusk = String(civilDusk.as<const char*>());
+  copyJsonString(civilDawn, twilight.civilDawn, sizeof(twilight.civilDawn));
+  copyJsonString(civilDusk, twilight.civilDusk, sizeof(twilight.civilDusk));
   return true;
 }
 
-static bool httpGetJson(const char* url, String& response) {
-  if (WiFi.status() != WL_CONNECTED) return false;
+// Reads the response into responseBody; returns its length or -1.
+static int httpGetJson(const char* url) {
+  if (WiFi.status() != WL_CONNECTED) return -1;
 
-  WiFiClientSecure client;
-  client.setInsecure();
+  HTTPClient* http = acquireHttps(url, kHttpTimeoutMs);
+  if (!http) return -1;
 
-  HTTPClient http;
-  if (!http.begin(client, url)) {
-    http.end();
-    return false;
-  }
-  http.setTimeout(kHttpTimeoutMs);
-
-  int status = http.GET();
+  int status = http->GET();
   if (status >= 200 && status < 300) {
-    response = http.getString();
-    http.end();
-    return true;
+    int len = readHttpsBody(http, responseBody, sizeof(responseBody));
+    releaseHttps(http, len >= 0);
+    return len;
   }
 
-  http.end();
-  return false;
+  if (status > 0) {
+    discardHttpsBody(http);
+  }
+  releaseHttps(http, status > 0);
+  return -1;
 }
 
 static bool fetchScheduleInternal() {
-  String scheduleBody;
-  if (!httpGetJson(kScheduleUrl, scheduleBody)) {
+  int len = httpGetJson(kScheduleUrl);
+  if (len < 0) {
     logScheduleEvent("schedule_error", "schedule_http");
     return false;
   }
 
   ScheduleConfig config;
-  if (!parseSchedule(scheduleBody, config)) {
+  if (!parseSchedule(responseBody, len, config)) {
     logScheduleEvent("schedule_error", "schedule_parse");
     return false;
   }
 
-  String start = config.startTime;
-  String end = config.endTime;
+  const char* start = config.startTime;
+  const char* end = config.endTime;
   TwilightTimes twilight;
+  bool startAtDusk = strcmp(config.startType, "civil_dusk") == 0;
+  bool endAtDawn = strcmp(config.endType, "civil_dawn") == 0;
 
-  if (config.startType == "civil_dusk" || config.endType == "civil_dawn") {
-    String twilightBody;
-    if (!httpGetJson(kTwilightUrl, twilightBody)) {
+  if (startAtDusk || endAtDawn) {
+    len = httpGetJson(kTwilightUrl);
+    if (len < 0) {
       logScheduleEvent("schedule_error", "twilight_http");
       return false;
     }
-    if (!parseTwilight(twilightBody, twilight)) {
+    if (!parseTwilight(responseBody, len, twilight)) {
       logScheduleEvent("schedule_error", "twilight_parse");
       return false;
     }
-    if (config.startType == "civil_dusk") {
+    if (startAtDusk) {
       start = twilight.civilDusk;
     }
-    if (config.endType == "civil_dawn") {
+    if (endAtDawn) {
       end = twilight.civilDawn;
     }
   }
 
-  if (start.length() < 5 || end.length() < 5) {
+  if (strlen(start) < 5 || strlen(end) < 5) {
     logScheduleEvent("schedule_error", "time_missing");
     return false;
   }
 
   scheduleConfig = config;
-  effectiveStart = start;
-  effectiveEnd = end;
+  strlcpy(effectiveStart, start, sizeof(effectiveStart));
+  strlcpy(effectiveEnd, end, sizeof(effectiveEnd));
   scheduleLoaded = true;
 
   struct tm timeInfo;
@@ -202,43 +203,26 @@ static bool fetchScheduleInternal() {
     lastFetchYday = timeInfo.tm_yday;
   }
 
-  String details = "Start: " + effectiveStart + " (" + scheduleConfig.startType + "), End: " +
-                   effectiveEnd + " (" + scheduleConfig.endType + ")";
+  char details[96];
+  snprintf(details, sizeof(details), "Start: %s (%s), End: %s (%s)", effectiveStart,
+           scheduleConfig.startType, effectiveEnd, scheduleConfig.endType);
   logScheduleEvent("schedule_loaded", details);
   return true;
 }
 
-void setupSchedule() {
-  configTzTime("CET-1CEST,M3.5.0/2,M10.5.0/3", "pool.ntp.org", "time.nist.gov", "time.google.com");
-  lastFetchAttemptMs = 0;
-  lastEvalMs = 0;
-  cachedState = ScheduleState::Unknown;
-}
-
-void handleSchedule() {
-  bool timeValid = timeIsValid();
-  if (!timeValid) {
-    cachedState = ScheduleState::Unknown;
-  }
-
-  unsigned long nowMs = millis();
-  if (!scheduleLoaded && (nowMs - lastFetchAttemptMs > kScheduleFetchRetryMs)) {
-    lastFetchAttemptMs = nowMs;
+static void fetchSchedule() {
+  if (!scheduleLoaded) {
     fetchScheduleInternal();
+    return;
   }
 
   struct tm timeInfo;
-  if (timeValid && getLocalTimeNow(timeInfo)) {
-    if (scheduleLoaded && timeInfo.tm_yday != lastFetchYday && timeInfo.tm_hour >= 3 &&
-        (nowMs - lastFetchAttemptMs > kScheduleFetchRetryMs)) {
-      lastFetchAttemptMs = nowMs;
-      fetchScheduleInternal();
-    }
+  if (getLocalTimeNow(timeInfo) && timeInfo.tm_yday != lastFetchYday && timeInfo.tm_hour >= 3) {
+    fetchScheduleInternal();
   }
+}
 
-  if (nowMs - lastEvalMs < kScheduleCheckIntervalMs) return;
-  lastEvalMs = nowMs;
-
+static void evaluateSchedule() {
   if (!scheduleLoaded) {
     cachedState = ScheduleState::Blocked;
     return;
@@ -249,17 +233,26 @@ void handleSchedule() {
     return;
   }
 
-  if (!timeValid || !getLocalTimeNow(timeInfo)) {
+  // Without NTP time the lamp stays blocked, as before the scheduler.
+  struct tm timeInfo;
+  if (!getLocalTimeNow(timeInfo)) {
     cachedState = ScheduleState::Blocked;
     return;
   }
 
   char currentTime[6];
   snprintf(currentTime, sizeof(currentTime), "%02d:%02d", timeInfo.tm_hour, timeInfo.tm_min);
-  bool active = shouldBeOn(String(currentTime), effectiveStart, effectiveEnd);
+  bool active = shouldBeOn(currentTime, effectiveStart, effectiveEnd);
   cachedState = active ? ScheduleState::Allowed : ScheduleState::Blocked;
 }
 
+void setupSchedule() {
+  configTzTime("CET-1CEST,M3.5.0/2,M10.5.0/3", "pool.ntp.org", "time.nist.gov", "time.google.com");
+  cachedState = ScheduleState::Unknown;
+  allowTaskAllocations(addPeriodicTask("schedule_fetch", fetchSchedule, kScheduleFetchRetryMs, PRIO_LOW));
+  addPeriodicTask("schedule_eval", evaluateSchedule, kScheduleCheckIntervalMs, PRIO_NORMAL);
+}
+
 ScheduleState getScheduleState() {
   return cachedState;
 }
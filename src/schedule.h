@@ -7,5 +7,4 @@ enum class ScheduleState {
 };
 
 void setupSchedule();
-void handleSchedule();
 ScheduleState getScheduleState();
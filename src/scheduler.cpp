@@ -0,0 +1,239 @@
+#include "scheduler.h"
+#include "flight_recorder.h"
+#include "heap_monitor.h"
+#include "log.h"
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 24
+#endif
+
+// A task that starts later than this past its deadline counts as a miss.
+#ifndef SCHEDULER_MISS_TOLERANCE_MS
+#define SCHEDULER_MISS_TOLERANCE_MS 20
+#endif
+
+#ifndef SCHEDULER_MAX_SLEEP_MS
+#define SCHEDULER_MAX_SLEEP_MS 100
+#endif
+
+#ifndef SCHEDULER_STATS_INTERVAL_MS
+#define SCHEDULER_STATS_INTERVAL_MS 300000
+#endif
+
+const uint16_t kLoopLatencyBucketsMs[LOOP_LATENCY_BUCKETS] = {1, 2, 5, 10, 20, 50, 100};
+
+static LoopLatencyHistogram latency;
+
+static void recordLatency(uint32_t lateMs) {
+  size_t bucket = 0;
+  while (bucket < LOOP_LATENCY_BUCKETS && lateMs > kLoopLatencyBucketsMs[bucket]) {
+    bucket++;
+  }
+  latency.buckets[bucket]++;
+  latency.count++;
+  latency.sumMs += lateMs;
+}
+
+struct Task {
+  TaskFn fn;
+  uint32_t periodMs;  // 0 for one-shot tasks
+  unsigned long dueMs;
+  uint8_t priority;
+  bool armed;
+  bool mayAllocate;
+  TaskStats stats;
+};
+
+static Task tasks[SCHEDULER_MAX_TASKS];
+static size_t taskCount = 0;
+
+// Binary min-heap of armed task ids, ordered by deadline, then priority.
+static uint8_t heap[SCHEDULER_MAX_TASKS];
+static size_t heapSize = 0;
+
+static bool runsBefore(uint8_t a, uint8_t b) {
+  long diff = (long)(tasks[a].dueMs - tasks[b].dueMs);
+  if (diff != 0) return diff < 0;
+  return tasks[a].priority < tasks[b].priority;
+}
+
+static void siftUp(size_t i) {
+  while (i > 0) {
+    size_t parent = (i - 1) / 2;
+    if (!runsBefore(heap[i], heap[parent])) break;
+    uint8_t tmp = heap[i];
+    heap[i] = heap[parent];
+    heap[parent] = tmp;
+    i = parent;
+  }
+}
+
+static void siftDown(size_t i) {
+  for (;;) {
+    size_t left = 2 * i + 1;
+    size_t right = left + 1;
+    size_t smallest = i;
+    if (left < heapSize && runsBefore(heap[left], heap[smallest])) smallest = left;
+    if (right < heapSize && runsBefore(heap[right], heap[smallest])) smallest = right;
+    if (smallest == i) break;
+    uint8_t tmp = heap[i];
+    heap[i] = heap[smallest];
+    heap[smallest] = tmp;
+    i = smallest;
+  }
+}
+
+static void pushTask(uint8_t id) {
+  tasks[id].armed = true;
+  heap[heapSize] = id;
+  siftUp(heapSize++);
+}
+
+static uint8_t popTask() {
+  uint8_t id = heap[0];
+  heap[0] = heap[--heapSize];
+  siftDown(0);
+  tasks[id].armed = false;
+  return id;
+}
+
+static void removeTask(uint8_t id) {
+  for (size_t i = 0; i < heapSize; i++) {
+    if (heap[i] != id) continue;
+    heap[i] = heap[--heapSize];
+    if (i < heapSize) {
+      siftDown(i);
+      siftUp(i);
+    }
+    tasks[id].armed = false;
+    return;
+  }
+}
+
+static void logTaskStats() {
+  for (size_t i = 0; i < taskCount; i++) {
+    const TaskStats& s = tasks[i].stats;
+    uint32_t avgUs = s.runs ? (uint32_t)(s.totalRunUs / s.runs) : 0;
+    LOG_PRINTF("Task %-14s runs=%u avg=%uus max=%uus misses=%u late=%ums allocs=%u\n", s.name,
+               (unsigned)s.runs, (unsigned)avgUs, (unsigned)s.maxRunUs, (unsigned)s.misses,
+               (unsigned)s.maxLateMs, (unsigned)s.allocs);
+  }
+}
+
+static int addTask(const char* name, TaskFn fn, uint32_t periodMs, uint32_t delayMs,
+                   uint8_t priority) {
+  if (taskCount >= SCHEDULER_MAX_TASKS) {
+    LOG_PRINTF("Scheduler voll, Task %s verworfen\n", name);
+    return -1;
+  }
+  static bool statsTaskAdded = false;
+  if (!statsTaskAdded) {
+    statsTaskAdded = true;
+    addTask("task_stats", logTaskStats, SCHEDULER_STATS_INTERVAL_MS,
+            SCHEDULER_STATS_INTERVAL_MS, PRIO_LOW);
+  }
+
+  uint8_t id = taskCount++;
+  Task& task = tasks[id];
+  task.fn = fn;
+  task.periodMs = periodMs;
+  task.priority = priority;
+  task.mayAllocate = false;
+  task.dueMs = millis() + delayMs;
+  task.stats = TaskStats();
+  task.stats.name = name;
+  pushTask(id);
+  return id;
+}
+
+int addPeriodicTask(const char* name, TaskFn fn, uint32_t periodMs, uint8_t priority) {
+  return addTask(name, fn, periodMs, periodMs, priority);
+}
+
+int addOneShotTask(const char* name, TaskFn fn, uint32_t delayMs, uint8_t priority) {
+  return addTask(name, fn, 0, delayMs, priority);
+}
+
+void allowTaskAllocations(int id) {
+  if (id < 0 || (size_t)id >= taskCount) return;
+  tasks[id].mayAllocate = true;
+}
+
+void rescheduleTask(int id, uint32_t delayMs) {
+  if (id < 0 || (size_t)id >= taskCount) return;
+  if (tasks[id].armed) {
+    removeTask(id);
+  }
+  tasks[id].dueMs = millis() + delayMs;
+  pushTask(id);
+}
+
+void runScheduler() {
+  while (heapSize > 0) {
+    unsigned long now = millis();
+    uint8_t id = heap[0];
+    Task& task = tasks[id];
+    long lateMs = (long)(now - task.dueMs);
+    if (lateMs < 0) break;
+    popTask();
+
+    if ((uint32_t)lateMs > task.stats.maxLateMs) {
+      task.stats.maxLateMs = lateMs;
+    }
+    if (lateMs > SCHEDULER_MISS_TOLERANCE_MS) {
+      task.stats.misses++;
+    }
+    recordLatency(lateMs);
+
+    flightRecordTaskStart(task.stats.name);
+    heapDebugBeginTask();
+    uint32_t start = micros();
+    task.fn();
+    uint32_t elapsed = micros() - start;
+    flightRecordTaskEnd(elapsed);
+    uint32_t allocs = heapDebugEndTask();
+    task.stats.allocs += allocs;
+    heapDebugCheck(task.stats.name, allocs, task.mayAllocate);
+    task.stats.runs++;
+    task.stats.lastRunUs = elapsed;
+    task.stats.totalRunUs += elapsed;
+    if (elapsed > task.stats.maxRunUs) {
+      task.stats.maxRunUs = elapsed;
+    }
+
+    // The task may have re-armed itself via rescheduleTask().
+    if (task.periodMs > 0 && !task.armed) {
+      task.dueMs += task.periodMs;
+      // After a long stall skip the missed runs instead of bursting.
+      if ((long)(millis() - task.dueMs) > (long)task.periodMs) {
+        task.dueMs = millis() + task.periodMs;
+      }
+      pushTask(id);
+    }
+  }
+
+  if (heapSize == 0) {
+    delay(SCHEDULER_MAX_SLEEP_MS);
+    return;
+  }
+  long waitMs = (long)(tasks[heap[0]].dueMs - millis());
+  if (waitMs > SCHEDULER_MAX_SLEEP_MS) waitMs = SCHEDULER_MAX_SLEEP_MS;
+  if (waitMs > 0) {
+    delay(waitMs);
+  } else {
+    yield();
+  }
+}
+
+size_t getTaskCount() {
+  return taskCount;
+}
+
+TaskStats getTaskStats(size_t id) {
+  if (id >= taskCount) return TaskStats();
+  return tasks[id].stats;
+}
+
+LoopLatencyHistogram getLoopLatencyHistogram() {
+  return latency;
+}
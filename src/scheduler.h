@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+
+typedef void (*TaskFn)();
+
+// When several tasks are due at once, the lower value runs first.
+enum TaskPriority : uint8_t {
+  PRIO_HIGH = 0,
+  PRIO_NORMAL = 1,
+  PRIO_LOW = 2
+};
+
+struct TaskStats {
+  const char* name;
+  uint32_t runs;
+  uint32_t misses;
+  uint32_t maxLateMs;
+  uint32_t lastRunUs;
+  uint32_t maxRunUs;
+  uint64_t totalRunUs;
+  uint32_t allocs;  // only counted in HEAP_DEBUG builds
+};
+
+// How late tasks start against their deadline; bucket i counts runs with
+// lateness <= kLoopLatencyBucketsMs[i] that did not fit a smaller bucket.
+#define LOOP_LATENCY_BUCKETS 7
+extern const uint16_t kLoopLatencyBucketsMs[LOOP_LATENCY_BUCKETS];
+
+struct LoopLatencyHistogram {
+  uint32_t buckets[LOOP_LATENCY_BUCKETS + 1];  // last one is +Inf
+  uint32_t count;
+  uint64_t sumMs;
+};
+
+// Both return a task id, or -1 if the task table is full.
+int addPeriodicTask(const char* name, TaskFn fn, uint32_t periodMs, uint8_t priority);
+int addOneShotTask(const char* name, TaskFn fn, uint32_t delayMs, uint8_t priority);
+// Marks a task that talks to the network and may allocate (HEAP_DEBUG).
+void allowTaskAllocations(int id);
+// Re-arms a task (also a finished one-shot) to run delayMs from now.
+void rescheduleTask(int id, uint32_t delayMs);
+
+// Runs every due task, then sleeps until the next deadline.
+void runScheduler();
+
+size_t getTaskCount();
+TaskStats getTaskStats(size_t id);
+LoopLatencyHistogram getLoopLatencyHistogram();
@@ -0,0 +1,104 @@
+#include "telemetry.h"
+#include <string.h>
+
+CborWriter::CborWriter(uint8_t* buffer, size_t capacity)
+    : buffer_(buffer), capacity_(capacity), length_(0), overflow_(false) {}
+
+void CborWriter::put(uint8_t byte) {
+  if (length_ >= capacity_) {
+    overflow_ = true;
+    return;
+  }
+  buffer_[length_++] = byte;
+}
+
+// Major type in the top three bits, argument in the shortest form.
+void CborWriter::head(uint8_t major, uint64_t value) {
+  uint8_t type = major << 5;
+  if (value < 24) {
+    put(type | (uint8_t)value);
+  } else if (value <= 0xFF) {
+    put(type | 24);
+    put((uint8_t)value);
+  } else if (value <= 0xFFFF) {
+    put(type | 25);
+    put((uint8_t)(value >> 8));
+    put((uint8_t)value);
+  } else if (value <= 0xFFFFFFFFULL) {
+    put(type | 26);
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      put((uint8_t)(value >> shift));
+    }
+  } else {
+    put(type | 27);
+    for (int shift = 56; shift >= 0; shift -= 8) {
+      put((uint8_t)(value >> shift));
+    }
+  }
+}
+
+void CborWriter::writeMap(size_t pairs) {
+  head(5, pairs);
+}
+
+void CborWriter::writeUint(uint64_t value) {
+  head(0, value);
+}
+
+void CborWriter::writeInt(int64_t value) {
+  if (value >= 0) {
+    head(0, (uint64_t)value);
+  } else {
+    head(1, (uint64_t)(-1 - value));
+  }
+}
+
+void CborWriter::writeBool(bool value) {
+  put(value ? 0xF5 : 0xF4);
+}
+
+void CborWriter::writeText(const char* value) {
+  size_t len = value ? strlen(value) : 0;
+  head(3, len);
+  for (size_t i = 0; i < len; i++) {
+    put((uint8_t)value[i]);
+  }
+}
+
+size_t encodeStatusCbor(uint8_t* buffer, size_t capacity, bool lightsOn, int brightness,
+                        bool motion) {
+  CborWriter w(buffer, capacity);
+  w.writeMap(3);
+  w.writeUint(STATUS_LIGHTS_ON);
+  w.writeBool(lightsOn);
+  w.writeUint(STATUS_BRIGHTNESS);
+  w.writeInt(brightness);
+  w.writeUint(STATUS_MOTION);
+  w.writeBool(motion);
+  return w.overflowed() ? 0 : w.length();
+}
+
+size_t encodeEventCbor(uint8_t* buffer, size_t capacity, const char* event, int zone,
+                       bool lightsOn, int brightness, bool motion, const char* message) {
+  bool hasZone = zone >= 0;
+  bool hasMessage = message && message[0] != '\0';
+  CborWriter w(buffer, capacity);
+  w.writeMap(4 + (hasZone ? 1 : 0) + (hasMessage ? 1 : 0));
+  w.writeUint(EVENT_NAME);
+  w.writeText(event);
+  if (hasZone) {
+    w.writeUint(EVENT_ZONE);
+    w.writeUint(zone);
+  }
+  w.writeUint(EVENT_LIGHTS_ON);
+  w.writeBool(lightsOn);
+  w.writeUint(EVENT_BRIGHTNESS);
+  w.writeInt(brightness);
+  w.writeUint(EVENT_MOTION);
+  w.writeBool(motion);
+  if (hasMessage) {
+    w.writeUint(EVENT_MESSAGE);
+    w.writeText(message);
+  }
+  return w.overflowed() ? 0 : w.length();
+}
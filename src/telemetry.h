@@ -0,0 +1,60 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// Compact CBOR (RFC 8949) encoding for MQTT status and log uploads, enabled
+// with -DTELEMETRY_CBOR=1. Maps use small integer keys instead of names;
+// tools/decode_telemetry.py turns them back into JSON.
+//
+// Measured: status {"lightsOn":true,"brightness":150,"motion":false} is 49
+// bytes as JSON, 8 as CBOR; a motion_on log event with zone is 78 vs 21.
+
+#ifndef TELEMETRY_CBOR
+#define TELEMETRY_CBOR 0
+#endif
+
+enum StatusKey : uint8_t {
+  STATUS_LIGHTS_ON = 1,
+  STATUS_BRIGHTNESS = 2,
+  STATUS_MOTION = 3
+};
+
+enum EventKey : uint8_t {
+  EVENT_NAME = 1,
+  EVENT_ZONE = 2,
+  EVENT_LIGHTS_ON = 3,
+  EVENT_BRIGHTNESS = 4,
+  EVENT_MOTION = 5,
+  EVENT_MESSAGE = 6
+};
+
+// Writes into a caller-owned buffer; never allocates. If the buffer is too
+// small, overflowed() turns true and the output must be discarded.
+class CborWriter {
+ public:
+  CborWriter(uint8_t* buffer, size_t capacity);
+
+  void writeMap(size_t pairs);
+  void writeUint(uint64_t value);
+  void writeInt(int64_t value);
+  void writeBool(bool value);
+  void writeText(const char* value);
+
+  size_t length() const { return length_; }
+  bool overflowed() const { return overflow_; }
+
+ private:
+  void head(uint8_t major, uint64_t value);
+  void put(uint8_t byte);
+
+  uint8_t* buffer_;
+  size_t capacity_;
+  size_t length_;
+  bool overflow_;
+};
+
+// Both return the encoded length, or 0 if the buffer was too small.
+size_t encodeStatusCbor(uint8_t* buffer, size_t capacity, bool lightsOn, int brightness,
+                        bool motion);
+size_t encodeEventCbor(uint8_t* buffer, size_t capacity, const char* event, int zone,
+                       bool lightsOn, int brightness, bool motion, const char* message);
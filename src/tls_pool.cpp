@@ -0,0 +1,235 @@
+#include "tls_pool.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include "log.h"
+#include "scheduler.h"
+
+#ifndef TLS_POOL_SIZE
+#define TLS_POOL_SIZE 2
+#endif
+
+#ifndef TLS_POOL_MAX_PER_HOST
+#define TLS_POOL_MAX_PER_HOST 1
+#endif
+
+#ifndef TLS_POOL_IDLE_TIMEOUT_MS
+#define TLS_POOL_IDLE_TIMEOUT_MS 60000
+#endif
+
+// Largest contiguous block needed for one mbedTLS handshake (~40 KB peak).
+#ifndef TLS_HANDSHAKE_HEAP_BYTES
+#define TLS_HANDSHAKE_HEAP_BYTES 45000
+#endif
+
+struct TlsSlot {
+  WiFiClientSecure client;
+  HTTPClient http;
+  char host[64];
+  const char* caCert;  // what the open connection was verified against
+  bool inUse;
+  unsigned long lastUsedMs;
+};
+
+static TlsSlot slots[TLS_POOL_SIZE];
+
+class DiscardStream : public Stream {
+ public:
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+  size_t write(uint8_t) override { return 1; }
+  size_t write(const uint8_t*, size_t size) override { return size; }
+};
+
+// Collects a response body (HTTPClient undoes chunked encoding for us) into
+// a caller-owned buffer.
+class BufferStream : public Stream {
+ public:
+  BufferStream(char* buffer, size_t size) : buffer_(buffer), size_(size) {}
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t* data, size_t size) override {
+    for (size_t i = 0; i < size; i++) {
+      if (length_ + 1 >= size_) {
+        overflow_ = true;
+        break;
+      }
+      buffer_[length_++] = (char)data[i];
+    }
+    buffer_[length_] = '\0';
+    return size;
+  }
+  size_t length() const { return length_; }
+  bool overflowed() const { return overflow_; }
+
+ private:
+  char* buffer_;
+  size_t size_;
+  size_t length_ = 0;
+  bool overflow_ = false;
+};
+
+static DiscardStream discardStream;
+
+static void handleTlsPool();
+
+static bool parseHost(const char* url, char* host, size_t hostSize) {
+  const char* start = strstr(url, "://");
+  if (!start) return false;
+  start += 3;
+  size_t len = strcspn(start, ":/?");
+  if (len == 0 || len >= hostSize) return false;
+  memcpy(host, start, len);
+  host[len] = '\0';
+  return true;
+}
+
+static bool slotConnected(TlsSlot& slot) {
+  return slot.host[0] != '\0' && slot.client.connected();
+}
+
+static void closeSlot(TlsSlot& slot) {
+  slot.client.stop();
+  slot.host[0] = '\0';
+}
+
+static bool handshakeFits() {
+  return ESP.getMaxAllocHeap() >= TLS_HANDSHAKE_HEAP_BYTES;
+}
+
+// Closes the least recently used idle connection. Returns false if none is left.
+static bool closeOldestIdle() {
+  TlsSlot* oldest = nullptr;
+  for (TlsSlot& slot : slots) {
+    if (slot.inUse || !slotConnected(slot)) continue;
+    if (!oldest || (long)(slot.lastUsedMs - oldest->lastUsedMs) < 0) {
+      oldest = &slot;
+    }
+  }
+  if (!oldest) return false;
+  closeSlot(*oldest);
+  return true;
+}
+
+void setupTlsPool() {
+  for (TlsSlot& slot : slots) {
+    slot.client.setInsecure();
+    slot.http.setReuse(true);
+    slot.host[0] = '\0';
+    slot.caCert = nullptr;
+    slot.inUse = false;
+    slot.lastUsedMs = 0;
+  }
+  allowTaskAllocations(addPeriodicTask("tls_pool", handleTlsPool, 1000, PRIO_LOW));
+}
+
+static void handleTlsPool() {
+  unsigned long now = millis();
+  for (TlsSlot& slot : slots) {
+    if (slot.inUse || slot.host[0] == '\0') continue;
+    if (!slot.client.connected() || now - slot.lastUsedMs > TLS_POOL_IDLE_TIMEOUT_MS) {
+      closeSlot(slot);
+    }
+  }
+}
+
+bool reserveTlsHandshake() {
+  while (!handshakeFits()) {
+    if (!closeOldestIdle()) return false;
+  }
+  return true;
+}
+
+HTTPClient* acquireHttps(const char* url, uint16_t timeoutMs, const char* caCert) {
+  if (WiFi.status() != WL_CONNECTED) return nullptr;
+
+  char host[sizeof(slots[0].host)];
+  if (!parseHost(url, host, sizeof(host))) return nullptr;
+
+  TlsSlot* chosen = nullptr;
+  int hostConnections = 0;
+  for (TlsSlot& slot : slots) {
+    if (strcmp(slot.host, host) != 0) continue;
+    if (slot.inUse) {
+      hostConnections++;
+    } else if (slot.caCert != caCert) {
+      // Opened with other trust settings; reconnect below.
+      closeSlot(slot);
+    } else if (slotConnected(slot)) {
+      chosen = &slot;
+      break;
+    }
+  }
+
+  if (!chosen) {
+    // A fresh handshake is needed.
+    if (hostConnections >= TLS_POOL_MAX_PER_HOST) return nullptr;
+    for (TlsSlot& slot : slots) {
+      if (!slot.inUse && !slotConnected(slot)) {
+        chosen = &slot;
+        break;
+      }
+    }
+    if (!chosen) {
+      if (!closeOldestIdle()) return nullptr;
+      for (TlsSlot& slot : slots) {
+        if (!slot.inUse && !slotConnected(slot)) {
+          chosen = &slot;
+          break;
+        }
+      }
+    }
+    if (!chosen) return nullptr;
+    closeSlot(*chosen);
+    if (!reserveTlsHandshake()) {
+      LOG_PRINTF("TLS: zu wenig Heap fuer Handshake (%u)\n", ESP.getMaxAllocHeap());
+      return nullptr;
+    }
+    strlcpy(chosen->host, host, sizeof(chosen->host));
+    chosen->caCert = caCert;
+    if (caCert) {
+      chosen->client.setCACert(caCert);
+    } else {
+      chosen->client.setInsecure();
+    }
+  }
+
+  if (!chosen->http.begin(chosen->client, url)) {
+    chosen->http.end();
+    closeSlot(*chosen);
+    return nullptr;
+  }
+  chosen->http.setTimeout(timeoutMs);
+  chosen->inUse = true;
+  return &chosen->http;
+}
+
+void releaseHttps(HTTPClient* http, bool keepAlive) {
+  for (TlsSlot& slot : slots) {
+    if (&slot.http != http) continue;
+    slot.http.end();
+    if (!keepAlive) {
+      closeSlot(slot);
+    }
+    slot.inUse = false;
+    slot.lastUsedMs = millis();
+    return;
+  }
+}
+
+void discardHttpsBody(HTTPClient* http) {
+  http->writeToStream(&discardStream);
+}
+
+int readHttpsBody(HTTPClient* http, char* buffer, size_t size) {
+  if (size == 0) return -1;
+  buffer[0] = '\0';
+  BufferStream stream(buffer, size);
+  if (http->writeToStream(&stream) < 0 || stream.overflowed()) return -1;
+  return (int)stream.length();
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <HTTPClient.h>
+
+void setupTlsPool();
+
+// Returns a begun HTTPClient on a pooled TLS connection for url, or nullptr
+// if no slot is free or the heap budget does not allow a new handshake yet.
+// With caCert (PEM) the server certificate must chain to it; without, it
+// is not checked.
+HTTPClient* acquireHttps(const char* url, uint16_t timeoutMs, const char* caCert = nullptr);
+void releaseHttps(HTTPClient* http, bool keepAlive);
+
+// Reads the response body into buffer and NUL-terminates it. Returns the
+// length, or -1 if it did not fit.
+int readHttpsBody(HTTPClient* http, char* buffer, size_t size);
+
+// Reads and drops an unread response body so the connection can be reused.
+void discardHttpsBody(HTTPClient* http);
+
+// Frees idle pooled connections until a TLS handshake fits into the heap.
+bool reserveTlsHandshake();
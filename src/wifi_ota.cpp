@@ -7,6 +7,9 @@
 #include "log.h"
 #include "leds.h"
 #include "pir.h"
+#include "scheduler.h"
+
+static void handleOTA();
 
 // WiFi Zugangsdaten
 const char* ssid = "ArmbrustWG";
@@ -37,9 +40,10 @@ void setupWiFi() {
   
   if (WiFi.status() == WL_CONNECTED) {
     LOG_PRINTLN("");
-    LOG_PRINT("WiFi verbunden! IP: ");
-    LOG_PRINTLN(WiFi.localIP().toString());
-    logEvent("wifi_connect_ok", false, 0, false, WiFi.localIP().toString());
+    char ip[16];
+    formatLocalIP(ip, sizeof(ip));
+    LOG_PRINTF("WiFi verbunden! IP: %s\n", ip);
+    logEvent("wifi_connect_ok", false, 0, false, ip);
   } else {
     LOG_PRINTLN("");
     LOG_PRINTLN("WiFi fehlgeschlagen!");
@@ -47,6 +51,11 @@ void setupWiFi() {
   }
 }
 
+void formatLocalIP(char* out, size_t size) {
+  IPAddress ip = WiFi.localIP();
+  snprintf(out, size, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+}
+
 void setupOTA() {
   if (WiFi.status() != WL_CONNECTED) return;
   
@@ -73,13 +82,16 @@ void setupOTA() {
     else if (error == OTA_CONNECT_ERROR) LOG_PRINTLN("Connect Failed");
     else if (error == OTA_RECEIVE_ERROR) LOG_PRINTLN("Receive Failed");
     else if (error == OTA_END_ERROR) LOG_PRINTLN("End Failed");
-    logEvent("ota_error", isLightOn(), getCurrentBrightness(), getMotionState(), String("code=") + String(error));
+    char message[16];
+    snprintf(message, sizeof(message), "code=%u", (unsigned)error);
+    logEvent("ota_error", isLightOn(), getCurrentBrightness(), getMotionState(), message);
   });
   
   ArduinoOTA.begin();
+  allowTaskAllocations(addPeriodicTask("ota", handleOTA, 50, PRIO_LOW));
   LOG_PRINTLN("OTA bereit!");
 }
 
-void handleOTA() {
+static void handleOTA() {
   ArduinoOTA.handle();
 }
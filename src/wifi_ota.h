@@ -1,5 +1,7 @@
 #pragma once
+#include <stddef.h>
 
 void setupWiFi();
 void setupOTA();
-void handleOTA();
\ No newline at end of file
+// Dotted IPv4 address without going through String.
+void formatLocalIP(char* out, size_t size);
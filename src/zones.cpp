@@ -0,0 +1,129 @@
+#include "zones.h"
+#include "leds.h"
+#include "log.h"
+#include "peer.h"
+#include "pir.h"
+#include "schedule.h"
+
+// Add a line per lamp; segment refers to LED_SEGn in leds.cpp.
+static const ZoneConfig kZoneConfigs[] = {
+  {{13, 14}, 0, 30000, ScheduleOverride::Follow},
+};
+
+static const size_t kZoneCount = sizeof(kZoneConfigs) / sizeof(kZoneConfigs[0]);
+static_assert(kZoneCount <= MAX_ZONES, "too many zones");
+
+// Runtime state, kept apart from the config so one pass walks a dense array.
+struct ZoneState {
+  unsigned long lastMotionMs;
+  ScheduleState lastScheduleState;
+  bool motion;
+  bool fading;
+  uint32_t motionCount;
+};
+
+static ZoneState zoneStates[kZoneCount];
+
+static ScheduleState effectiveSchedule(const ZoneConfig& config, ScheduleState shared) {
+  switch (config.scheduleOverride) {
+    case ScheduleOverride::AlwaysAllowed: return ScheduleState::Allowed;
+    case ScheduleOverride::AlwaysBlocked: return ScheduleState::Blocked;
+    default: return shared;
+  }
+}
+
+void setupZones() {
+  for (size_t z = 0; z < kZoneCount; z++) {
+    zoneStates[z] = ZoneState();
+    zoneStates[z].lastScheduleState = ScheduleState::Unknown;
+  }
+  LOG_PRINTF("%u Zone(n) konfiguriert\n", (unsigned)kZoneCount);
+}
+
+void updateZones() {
+  ScheduleState sharedState = getScheduleState();
+  unsigned long now = millis();
+
+  for (uint8_t z = 0; z < kZoneCount; z++) {
+    const ZoneConfig& config = kZoneConfigs[z];
+    ZoneState& state = zoneStates[z];
+    uint8_t segment = config.segment;
+
+    ScheduleState scheduleState = effectiveSchedule(config, sharedState);
+    bool allowMotion = (scheduleState != ScheduleState::Blocked);
+    bool motionDetected = allowMotion ? isMotionDetected(z) : false;
+
+    if (motionDetected != state.motion) {
+      if (motionDetected) {
+        // Sensor 1 sits at the first pixel: the chase follows the walker.
+        setSegmentDirection(segment, getTriggeredSensor(z) == 2 ? -1 : 1);
+        broadcastMotion(z);
+        state.motionCount++;
+      }
+      logZoneEvent(z, motionDetected ? "motion_on" : "motion_off", isLightOn(segment),
+                   getCurrentBrightness(segment), motionDetected, nullptr);
+      state.motion = motionDetected;
+    }
+
+    if (scheduleState == ScheduleState::Blocked) {
+      if (scheduleState != state.lastScheduleState && isLightOn(segment)) {
+        startFadeOut(segment);
+        logZoneEvent(z, "auto_off", isLightOn(segment), getCurrentBrightness(segment),
+                     motionDetected, "schedule_blocked");
+      }
+    } else if (motionDetected) {
+      state.lastMotionMs = now;
+
+      if (!isLightOn(segment)) {
+        startFadeIn(segment);
+        logZoneEvent(z, "auto_on", true, getCurrentBrightness(segment), motionDetected, "motion");
+      }
+    }
+    state.lastScheduleState = scheduleState;
+
+    if (isLightOn(segment) && allowMotion && (now - state.lastMotionMs > config.motionTimeoutMs)) {
+      startFadeOut(segment);
+    }
+
+    bool fading = isFadeActive(segment);
+    if (state.fading && !fading) {
+      bool on = isLightOn(segment);
+      logZoneEvent(z, on ? "light_on" : "light_off", on, getCurrentBrightness(segment),
+                   motionDetected, on ? "fade_in_complete" : "fade_out_complete");
+    }
+    state.fading = fading;
+  }
+}
+
+size_t getZoneCount() {
+  return kZoneCount;
+}
+
+const ZoneConfig& getZoneConfig(uint8_t zone) {
+  return kZoneConfigs[zone < kZoneCount ? zone : 0];
+}
+
+ZoneStatus getZoneStatus(uint8_t zone) {
+  ZoneStatus status = {false, 0, false, 0};
+  if (zone >= kZoneCount) return status;
+  uint8_t segment = kZoneConfigs[zone].segment;
+  status.lightsOn = isLightOn(segment);
+  status.brightness = getCurrentBrightness(segment);
+  status.motion = zoneStates[zone].motion;
+  status.motionCount = zoneStates[zone].motionCount;
+  return status;
+}
+
+void triggerZoneFromPeer(uint8_t zone) {
+  if (zone >= kZoneCount) return;
+  const ZoneConfig& config = kZoneConfigs[zone];
+  if (effectiveSchedule(config, getScheduleState()) == ScheduleState::Blocked) return;
+
+  ZoneState& state = zoneStates[zone];
+  // Restarts the timeout just like local motion would.
+  state.lastMotionMs = millis();
+  if (!isLightOn(config.segment)) {
+    startFadeIn(config.segment);
+    logZoneEvent(zone, "auto_on", true, getCurrentBrightness(config.segment), state.motion, "peer");
+  }
+}
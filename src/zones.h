@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+#define MAX_ZONES 4
+
+enum class ScheduleOverride : uint8_t {
+  Follow,         // obey the shared schedule
+  AlwaysAllowed,  // react to motion around the clock
+  AlwaysBlocked   // stay dark
+};
+
+// One lamp: its PIR sensors (0xFF = unused), LED segment and timing.
+struct ZoneConfig {
+  uint8_t pirPins[2];
+  uint8_t segment;
+  unsigned long motionTimeoutMs;
+  ScheduleOverride scheduleOverride;
+};
+
+struct ZoneStatus {
+  bool lightsOn;
+  int brightness;
+  bool motion;
+  uint32_t motionCount;  // rising motion edges since boot
+};
+
+void setupZones();
+// Runs motion, timeout and schedule logic for every zone in one pass.
+void updateZones();
+size_t getZoneCount();
+const ZoneConfig& getZoneConfig(uint8_t zone);
+ZoneStatus getZoneStatus(uint8_t zone);
+// Pre-lights a zone because a neighbouring lamp saw motion; obeys the schedule.
+void triggerZoneFromPeer(uint8_t zone);
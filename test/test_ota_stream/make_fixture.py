@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""Regenerates ota_fixture.h for test_ota_stream.
+
+The raw image is produced by the same formula as makeRawImage() in
+test_main.cpp, packed with tools/pack_ota.py and written as a C array. The
+header is signed with a throwaway key; the parser does not check it.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+
+RAW_SIZE = 10000
+TEXT = b"railroad lantern motion fade zone "
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PACKER = os.path.join(HERE, "..", "..", "tools", "pack_ota.py")
+
+
+def raw_image():
+    out = bytearray()
+    x = 12345
+    for i in range(RAW_SIZE):
+        x = (x * 1103515245 + 12345) & 0xFFFFFFFF
+        out.append(TEXT[i % len(TEXT)] if i % 64 < 40 else (x >> 16) & 0xFF)
+    return bytes(out)
+
+
+def main():
+    with tempfile.TemporaryDirectory() as tmp:
+        raw_path = os.path.join(tmp, "raw.bin")
+        packed_path = os.path.join(tmp, "raw.rlo")
+        key_path = os.path.join(tmp, "key.pem")
+        with open(raw_path, "wb") as f:
+            f.write(raw_image())
+        subprocess.check_call(["openssl", "ecparam", "-name", "prime256v1", "-genkey", "-noout",
+                               "-out", key_path])
+        subprocess.check_call([sys.executable, PACKER, "--key", key_path, "--block-size", "4096",
+                               "-w", "8", "-l", "4", raw_path, packed_path])
+        with open(packed_path, "rb") as f:
+            packed = f.read()
+
+    lines = ["// Generated by make_fixture.py, do not edit.", "#pragma once", "#include <stdint.h>", "",
+             "#define OTA_FIXTURE_RAW_SIZE %d" % RAW_SIZE, "",
+             "static const uint8_t kPackedImage[] = {"]
+    for i in range(0, len(packed), 16):
+        lines.append("  " + " ".join("0x%02x," % b for b in packed[i:i + 16]))
+    lines.append("};")
+    with open(os.path.join(HERE, "ota_fixture.h"), "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
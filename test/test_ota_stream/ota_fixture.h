@@ -0,0 +1,335 @@
+// Generated by make_fixture.py, do not edit.
+#pragma once
+#include <stdint.h>
+
+#define OTA_FIXTURE_RAW_SIZE 10000
+
+static const uint8_t kPackedImage[] = {
+  0x52, 0x4c, 0x4f, 0x32, 0x10, 0x27, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0xa3, 0x71, 0xc4, 0xd0, 0x57, 0x12, 0xd5, 0x02, 0xcc, 0x3c, 0x47, 0xa2,
+  0x28, 0xd9, 0xca, 0xa0, 0xf3, 0xcf, 0x37, 0xe1, 0x22, 0xa9, 0x07, 0x01, 0x5e, 0x55, 0xdb, 0xda,
+  0x86, 0x88, 0xfe, 0x4c, 0x11, 0xbf, 0x75, 0xf2, 0x0d, 0x7d, 0x41, 0xa2, 0x91, 0x43, 0x2b, 0x35,
+  0xcf, 0xe9, 0x88, 0x39, 0xb5, 0x5d, 0xfd, 0x06, 0xf5, 0x4e, 0x51, 0xf3, 0x61, 0xfe, 0xc0, 0xee,
+  0x14, 0xf4, 0xc0, 0x75, 0x54, 0x5b, 0xd0, 0x84, 0x3f, 0xe9, 0x57, 0x92, 0xe4, 0xc1, 0xd2, 0xca,
+  0xe8, 0x56, 0x62, 0x98, 0xc7, 0x5b, 0xfd, 0xe8, 0xc6, 0x04, 0x23, 0xde, 0x0d, 0xb9, 0xe6, 0xa0,
+  0xd7, 0x01, 0x0a, 0x52, 0x1b, 0x08, 0x00, 0x00, 0x13, 0xa0, 0x73, 0xf0, 0xb9, 0x58, 0x6d, 0x36,
+  0xcb, 0x95, 0xbe, 0xc3, 0x64, 0x90, 0x5b, 0x2c, 0x36, 0xeb, 0xa5, 0x96, 0xe5, 0x6e, 0x90, 0x5b,
+  0x6d, 0xf7, 0x4b, 0x4d, 0xbe, 0xdd, 0x20, 0xb3, 0x58, 0x6c, 0x96, 0x59, 0x05, 0xea, 0xdf, 0x6e,
+  0xb2, 0xc8, 0x04, 0x2b, 0x08, 0xac, 0xf4, 0x7d, 0xd3, 0x98, 0x87, 0x2e, 0x91, 0x95, 0xda, 0xf3,
+  0x31, 0x32, 0x98, 0x8f, 0xfe, 0x0d, 0xb6, 0xb1, 0x4b, 0xbb, 0xf3, 0xcf, 0xcc, 0xd7, 0xfa, 0x21,
+  0x92, 0x1f, 0x90, 0xf7, 0x41, 0xeb, 0xc9, 0xc9, 0xbc, 0x96, 0x28, 0x97, 0x56, 0x1b, 0xcb, 0xd9,
+  0xdd, 0xe2, 0xb6, 0xab, 0x54, 0xea, 0xd1, 0xba, 0xc7, 0x76, 0xee, 0x90, 0x8a, 0x36, 0x78, 0xcb,
+  0xa4, 0x3f, 0x21, 0xcc, 0xa6, 0xfd, 0x93, 0xca, 0xf2, 0xe2, 0x5c, 0x5a, 0xbf, 0x3a, 0xb5, 0xf1,
+  0xea, 0x45, 0xa3, 0x1d, 0x78, 0xce, 0xf2, 0x09, 0x5b, 0xbf, 0x66, 0x6c, 0xbf, 0x1d, 0x12, 0xa7,
+  0xc8, 0x7e, 0x43, 0x7b, 0x1f, 0x4f, 0x25, 0xfc, 0xd7, 0xf7, 0xf4, 0x58, 0xcc, 0xbc, 0x8e, 0x8b,
+  0x62, 0xf5, 0xf7, 0x60, 0xf6, 0x5b, 0x87, 0xfe, 0xb1, 0x89, 0xb5, 0x73, 0xfe, 0xfc, 0xa5, 0x4f,
+  0x90, 0xfc, 0x86, 0xf0, 0xed, 0x55, 0x42, 0x37, 0x50, 0xc5, 0x5a, 0xa6, 0xd2, 0x9f, 0x35, 0xc3,
+  0xbf, 0x55, 0xbb, 0xee, 0xbb, 0x94, 0x4b, 0x6d, 0x0f, 0x77, 0xa9, 0x84, 0x45, 0xfa, 0xca, 0x9f,
+  0x21, 0xf9, 0x0d, 0xfd, 0x3c, 0x3c, 0x66, 0xc6, 0xdd, 0xd3, 0xee, 0xc4, 0xa8, 0x96, 0x29, 0x94,
+  0x32, 0x29, 0xa7, 0xd7, 0xcf, 0xff, 0x50, 0xce, 0xf7, 0x5a, 0x27, 0xce, 0x89, 0xe1, 0x95, 0x3e,
+  0x43, 0xf2, 0x1b, 0xed, 0x7b, 0xd0, 0x7b, 0xff, 0x26, 0xf3, 0xba, 0xf1, 0xea, 0x2b, 0x14, 0xad,
+  0x4f, 0xa2, 0x5b, 0xa8, 0xa6, 0xd4, 0x33, 0xbe, 0x6c, 0xc5, 0xaf, 0xc5, 0xa9, 0xcd, 0x2a, 0x7c,
+  0x87, 0xe4, 0x37, 0x99, 0x6e, 0xb0, 0x34, 0x59, 0x04, 0xf7, 0x87, 0x67, 0x8a, 0x62, 0x2f, 0x57,
+  0x5c, 0x87, 0x22, 0xc7, 0xc7, 0x83, 0xf8, 0x23, 0xdc, 0x2b, 0x84, 0x0f, 0x35, 0xd1, 0x54, 0xf9,
+  0x0f, 0xc8, 0x6f, 0x1f, 0x8c, 0x6e, 0xb8, 0x73, 0x4e, 0xfe, 0xda, 0xc1, 0x4a, 0xd9, 0x60, 0x26,
+  0x5c, 0xd9, 0xce, 0x86, 0xdd, 0xdf, 0xca, 0x51, 0x22, 0x9e, 0x1f, 0x9e, 0x9b, 0xd8, 0xa9, 0xf2,
+  0x1f, 0x90, 0xde, 0x7d, 0xb8, 0xb8, 0xee, 0x78, 0x91, 0xfa, 0x9e, 0x2e, 0x11, 0x95, 0x8e, 0x67,
+  0xab, 0xf4, 0x09, 0x0f, 0xff, 0x2f, 0x7a, 0x8d, 0x53, 0x6f, 0xf7, 0x0c, 0x66, 0xad, 0x53, 0xe4,
+  0x3f, 0x21, 0xbd, 0x36, 0xb3, 0x68, 0xf3, 0x64, 0xb7, 0x95, 0xcd, 0x5c, 0x3b, 0xe7, 0x10, 0xbc,
+  0xc1, 0xb3, 0xba, 0x59, 0xef, 0xc6, 0xa5, 0x5d, 0x97, 0x42, 0x67, 0x70, 0xde, 0x72, 0xa7, 0xc8,
+  0x7e, 0x43, 0x78, 0x6e, 0xf2, 0xbb, 0x0b, 0xae, 0x5e, 0x31, 0xf7, 0xe8, 0xf6, 0x2a, 0x35, 0x85,
+  0xc0, 0xc3, 0xfd, 0x7e, 0x6d, 0x5f, 0x73, 0xa1, 0x77, 0xa0, 0xc5, 0x3d, 0x31, 0x45, 0x4f, 0x90,
+  0xfc, 0x86, 0xf3, 0xdd, 0x0c, 0x43, 0xd1, 0xe3, 0x88, 0xeb, 0x78, 0xdf, 0x68, 0xd7, 0xef, 0x01,
+  0x91, 0xac, 0x6c, 0xf7, 0x78, 0x5e, 0xbc, 0xc7, 0xd1, 0xe5, 0xdd, 0x78, 0x27, 0xca, 0x9f, 0x21,
+  0xf9, 0x0d, 0xf3, 0xfc, 0x8a, 0x1c, 0xf3, 0xcf, 0x47, 0xbb, 0x50, 0x2a, 0xf6, 0x5b, 0x9c, 0xaf,
+  0xed, 0x35, 0xdf, 0xdf, 0x28, 0x30, 0x4a, 0x15, 0x03, 0x6d, 0xee, 0xd8, 0xc3, 0x15, 0x3e, 0x43,
+  0xf2, 0x1b, 0xfc, 0x7e, 0x1b, 0x4e, 0x44, 0x9f, 0xb9, 0xa9, 0xd7, 0xc0, 0x25, 0x34, 0x1a, 0x35,
+  0xbe, 0xd3, 0xcd, 0xf4, 0xe7, 0x64, 0x7c, 0x0a, 0x0d, 0xd2, 0xe1, 0x1d, 0x9e, 0xaa, 0x7c, 0x87,
+  0xe4, 0x37, 0xf9, 0xf6, 0xe4, 0x94, 0xcb, 0x2e, 0x3a, 0x11, 0xd1, 0xd9, 0xc9, 0xe4, 0xf9, 0x0d,
+  0xf6, 0xcf, 0x3d, 0xc1, 0xad, 0x7d, 0x2d, 0xda, 0x9e, 0xf4, 0x03, 0xc9, 0x93, 0x54, 0xf9, 0x0f,
+  0xc8, 0x6f, 0x67, 0xa3, 0xd4, 0xf1, 0x15, 0xf8, 0xf5, 0x46, 0xcf, 0x2e, 0x8f, 0xf8, 0xf9, 0x5a,
+  0x1e, 0x97, 0xcb, 0x8b, 0x38, 0x9b, 0x42, 0xa7, 0x1b, 0x5a, 0xef, 0x1b, 0x98, 0xa9, 0xf2, 0x1f,
+  0x90, 0xde, 0x17, 0xf4, 0x80, 0x4f, 0x3a, 0xb4, 0xca, 0x24, 0xc6, 0x65, 0xd0, 0x9b, 0x6d, 0x3b,
+  0x38, 0x7c, 0x4e, 0xd7, 0xef, 0xab, 0xab, 0x6c, 0x37, 0x34, 0x8c, 0x16, 0xa1, 0x53, 0xe4, 0x3f,
+  0x21, 0xbe, 0x83, 0x49, 0xec, 0x93, 0xe2, 0x7a, 0xfa, 0x3f, 0x7d, 0xff, 0xf7, 0xdf, 0x87, 0x49,
+  0x72, 0x32, 0x2a, 0x8d, 0x5a, 0x23, 0x0f, 0xe7, 0xea, 0xb0, 0x3d, 0xaf, 0x4a, 0xa7, 0xc8, 0x7e,
+  0x43, 0x7f, 0x34, 0x57, 0xaf, 0x0a, 0x9c, 0xe0, 0x25, 0x96, 0x0e, 0xa5, 0x83, 0x3f, 0x98, 0xa3,
+  0xec, 0xaf, 0xd5, 0x88, 0xb4, 0xa3, 0xf1, 0x56, 0xa3, 0xf2, 0x31, 0x74, 0xd5, 0x4f, 0x90, 0xfc,
+  0x86, 0xf9, 0xd8, 0x46, 0x07, 0x4b, 0xa6, 0x83, 0xe8, 0x28, 0xbf, 0x2d, 0xfc, 0xda, 0x23, 0xfd,
+  0xd4, 0x57, 0x71, 0x7f, 0x7d, 0x97, 0x3e, 0x0b, 0x51, 0xee, 0x56, 0x32, 0xaa, 0x9f, 0x21, 0xf9,
+  0x0d, 0xf0, 0x93, 0xdd, 0x4e, 0xdf, 0x21, 0x2c, 0xdf, 0xd7, 0xb3, 0x3d, 0x7b, 0x24, 0xea, 0x0f,
+  0x34, 0xbf, 0xea, 0xb7, 0x16, 0xda, 0xb6, 0x6f, 0x11, 0x7e, 0x80, 0x60, 0x55, 0x3e, 0x43, 0xf2,
+  0x1b, 0xd7, 0x2e, 0x71, 0x08, 0x0e, 0xdb, 0x5d, 0x48, 0xb5, 0xe2, 0x6d, 0x5e, 0x9e, 0x94, 0x9e,
+  0x2d, 0xa3, 0xba, 0x46, 0xa3, 0x54, 0xae, 0xce, 0xb2, 0xdd, 0x42, 0xe8, 0xaa, 0x7c, 0x87, 0xe4,
+  0x37, 0xf2, 0xdb, 0x2e, 0xd4, 0x3e, 0xd5, 0x3f, 0xf9, 0x2b, 0xc0, 0xcd, 0x70, 0x99, 0xb8, 0xdc,
+  0x37, 0x15, 0xab, 0xee, 0xde, 0x2d, 0xd7, 0xfb, 0xe5, 0xb3, 0xbf, 0x44, 0x54, 0xf9, 0x0f, 0xc8,
+  0x6f, 0xdf, 0xf3, 0x66, 0xe7, 0xbb, 0xae, 0x6e, 0x6e, 0xbf, 0x42, 0xfd, 0xfd, 0xaa, 0x7a, 0x5e,
+  0xd7, 0xd2, 0x1b, 0xc1, 0xa4, 0xe0, 0x69, 0xbb, 0xa9, 0xbe, 0x5b, 0x36, 0xa9, 0xf2, 0x1f, 0x90,
+  0xde, 0x13, 0xa1, 0x9f, 0x6b, 0xe2, 0xde, 0x8f, 0x2f, 0x1f, 0x19, 0x7b, 0xff, 0xee, 0xf0, 0x53,
+  0xdd, 0x05, 0x6f, 0x0d, 0x4b, 0xa1, 0x40, 0xa4, 0x99, 0x09, 0x4e, 0x59, 0x53, 0xe4, 0x3f, 0x21,
+  0xbc, 0x92, 0xbf, 0x21, 0xac, 0x6c, 0x2c, 0x59, 0xa9, 0x1c, 0x7e, 0xe9, 0x5e, 0xc9, 0xdd, 0x7e,
+  0xd5, 0x0a, 0xa7, 0xae, 0x7f, 0x72, 0xaf, 0xde, 0xa6, 0xf5, 0x6f, 0xa2, 0xa7, 0xc8, 0x7e, 0x43,
+  0x7f, 0x87, 0x7a, 0x05, 0xf9, 0xa3, 0x7e, 0x6f, 0x33, 0x2d, 0xd6, 0x9f, 0xab, 0x9a, 0x9e, 0x71,
+  0x38, 0x5b, 0xad, 0x8f, 0x97, 0xa1, 0x24, 0xbf, 0x7b, 0x3b, 0xd7, 0x75, 0x4f, 0x90, 0xfc, 0x86,
+  0xf2, 0xce, 0xfe, 0x86, 0xa5, 0x99, 0xb7, 0x50, 0xf6, 0xb1, 0xee, 0xa4, 0x8b, 0x25, 0x98, 0xb4,
+  0xed, 0xe9, 0x79, 0x8f, 0xe4, 0x7a, 0x23, 0xee, 0xb7, 0x60, 0x7b, 0xaa, 0x9f, 0x21, 0xf9, 0x0d,
+  0xf3, 0x52, 0x2e, 0x04, 0x8a, 0xd3, 0x81, 0xdc, 0x5b, 0x21, 0x7b, 0xa8, 0x34, 0xe6, 0x93, 0xa2,
+  0xf7, 0x72, 0x2b, 0xf4, 0x58, 0xd7, 0x9b, 0x17, 0x7f, 0xff, 0x79, 0xd5, 0x3e, 0x43, 0xf2, 0x1b,
+  0xfe, 0x2c, 0xd1, 0xd9, 0x55, 0xd7, 0xe3, 0x97, 0x8b, 0xd0, 0x63, 0x54, 0x0a, 0x7c, 0x3e, 0x65,
+  0x29, 0xf8, 0x71, 0xf0, 0x18, 0x5b, 0x14, 0x57, 0xb9, 0x16, 0xaa, 0x2a, 0x7c, 0x87, 0xe4, 0x37,
+  0x83, 0xdb, 0x2f, 0x32, 0xab, 0xfd, 0xff, 0x43, 0x75, 0xbf, 0xed, 0x32, 0x39, 0x6d, 0x4f, 0x62,
+  0x4d, 0x84, 0xc8, 0x5b, 0x63, 0xd4, 0x6a, 0x5d, 0x23, 0x13, 0xe5, 0x54, 0xf9, 0x0f, 0xc8, 0x6f,
+  0x86, 0xfa, 0x65, 0x3c, 0x54, 0x5f, 0x5e, 0x5a, 0x8f, 0x87, 0xa4, 0x6e, 0x79, 0x9d, 0x8a, 0x9e,
+  0x9a, 0x8b, 0x7a, 0xe5, 0xe9, 0xea, 0x3e, 0xec, 0x14, 0x5e, 0xb4, 0xa9, 0xf2, 0x1f, 0x90, 0xde,
+  0x6f, 0xbe, 0x96, 0xc4, 0xb0, 0xff, 0x59, 0xb5, 0x36, 0x2f, 0x95, 0xbc, 0x6c, 0xab, 0x96, 0x4b,
+  0x47, 0xc2, 0x8b, 0x5b, 0xef, 0x51, 0x77, 0xd4, 0x9b, 0xfd, 0xcd, 0x53, 0xe4, 0x3f, 0x21, 0xbf,
+  0x63, 0x15, 0x05, 0xbc, 0xc1, 0xeb, 0xb4, 0x1a, 0x3f, 0xbe, 0xb9, 0x8e, 0x84, 0x7d, 0x79, 0x52,
+  0xda, 0x46, 0xc3, 0xbb, 0x84, 0xf0, 0x5e, 0xeb, 0xd8, 0x2f, 0x82, 0xa7, 0xc8, 0x7e, 0x43, 0x79,
+  0x4c, 0x5f, 0xb9, 0xd8, 0xc1, 0xf8, 0xae, 0xdf, 0x4e, 0x8d, 0x77, 0x75, 0x8d, 0xb1, 0x51, 0xf6,
+  0xd0, 0xbb, 0xe4, 0x46, 0xb1, 0xe3, 0xf2, 0x60, 0x3c, 0x19, 0x05, 0x4f, 0x90, 0xfc, 0x86, 0xfe,
+  0xc9, 0x35, 0xcb, 0xdf, 0xbc, 0xa2, 0xe5, 0xa2, 0xb7, 0xba, 0xc6, 0xf6, 0x05, 0x64, 0xcc, 0xf0,
+  0x3f, 0x56, 0x9d, 0xb4, 0x72, 0x1d, 0xba, 0xb8, 0xd6, 0x62, 0x8a, 0x9f, 0x21, 0xf9, 0x0d, 0xfb,
+  0xf7, 0x7c, 0x35, 0xf6, 0xe5, 0x45, 0xb0, 0xda, 0xb5, 0xd0, 0xda, 0xbc, 0x9f, 0x77, 0x81, 0x87,
+  0x75, 0x66, 0xd8, 0xec, 0x74, 0x83, 0x7b, 0xef, 0xd6, 0x4f, 0x15, 0x3e, 0x43, 0xf2, 0x1b, 0xf0,
+  0xf9, 0x3d, 0x9a, 0x25, 0x93, 0x49, 0x96, 0xd9, 0xca, 0x67, 0x74, 0x7d, 0xe4, 0x9f, 0x7f, 0x5e,
+  0xae, 0x69, 0x6a, 0xd6, 0xfe, 0xd6, 0xb7, 0x77, 0x9b, 0xe4, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xac,
+  0x77, 0x65, 0x70, 0x2a, 0xa4, 0x83, 0xed, 0xaf, 0xd7, 0x68, 0xe9, 0xf8, 0x1b, 0x3c, 0x4a, 0xe3,
+  0x4e, 0xba, 0x74, 0x6f, 0xdf, 0xca, 0x4e, 0x53, 0xc7, 0x77, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x5e,
+  0xb9, 0xcf, 0x2e, 0xf0, 0x0b, 0xd5, 0x06, 0x3f, 0xfb, 0x82, 0x4b, 0x66, 0xb3, 0xc9, 0xdc, 0x1e,
+  0xd9, 0x63, 0xdf, 0x5f, 0x68, 0xd5, 0x39, 0xe5, 0x1e, 0x14, 0xa9, 0xf2, 0x1f, 0x90, 0xdf, 0x29,
+  0x4b, 0xe6, 0x59, 0x65, 0x17, 0x29, 0xbf, 0x0f, 0xa3, 0x20, 0xd0, 0xe6, 0x6c, 0xdf, 0xaf, 0x05,
+  0xda, 0x69, 0xdc, 0x95, 0x5d, 0xf1, 0x37, 0x1c, 0x35, 0x05, 0x53, 0xe4, 0x3f, 0x21, 0xbe, 0xee,
+  0x49, 0x9a, 0xc5, 0x63, 0xb8, 0xf9, 0x7a, 0xdf, 0xc3, 0x6b, 0x6d, 0xb6, 0x69, 0x21, 0xfb, 0xb9,
+  0x66, 0x97, 0xd9, 0x46, 0xa8, 0xea, 0xfe, 0x95, 0xfe, 0xda, 0xa7, 0xc8, 0x7e, 0x43, 0x7c, 0x9f,
+  0x02, 0xcf, 0xa7, 0xf8, 0x4e, 0xe4, 0x7a, 0x68, 0xbe, 0x12, 0x9f, 0x70, 0xdc, 0x4e, 0x6b, 0x34,
+  0xdb, 0xbe, 0xb7, 0x21, 0x92, 0xbd, 0xe1, 0x32, 0x79, 0xa5, 0x4f, 0x90, 0xfc, 0x86, 0xfd, 0xce,
+  0xef, 0xca, 0xf9, 0x0f, 0xc5, 0xe6, 0x6c, 0xb0, 0x7a, 0x6c, 0x22, 0xc7, 0x60, 0x9d, 0x5e, 0xb3,
+  0x56, 0xaf, 0x0f, 0x2b, 0xf5, 0xb7, 0xf1, 0xf8, 0x67, 0x8a, 0x9f, 0x21, 0xf9, 0x0d, 0xea, 0xb3,
+  0xbf, 0xef, 0x23, 0x57, 0x7a, 0xdc, 0xd6, 0x30, 0x1c, 0xfa, 0xc4, 0x1a, 0xbb, 0xcf, 0xef, 0x74,
+  0xe7, 0xb4, 0x6d, 0x95, 0x2e, 0x41, 0xcf, 0x85, 0xe0, 0x55, 0x3e, 0x43, 0xf2, 0x1b, 0xef, 0xf3,
+  0x94, 0x6a, 0x6e, 0x0f, 0x8f, 0x45, 0x9f, 0xd0, 0xb9, 0x7f, 0xf8, 0xcd, 0xbb, 0x77, 0x44, 0xdc,
+  0x6c, 0xb3, 0xb0, 0x9a, 0x1d, 0xd6, 0x13, 0xcf, 0x95, 0xaa, 0x7c, 0x87, 0xe4, 0x37, 0xed, 0x6f,
+  0xb1, 0xdc, 0x9a, 0xcc, 0xc7, 0xf7, 0xd9, 0x86, 0x40, 0x77, 0x95, 0xba, 0xae, 0xf6, 0xdb, 0x08,
+  0xc3, 0xe9, 0x71, 0xda, 0x3b, 0xc5, 0x47, 0xdd, 0xf8, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x65, 0xb1,
+  0x65, 0x7f, 0x9e, 0xbb, 0xce, 0x73, 0xcf, 0x9f, 0x98, 0xd4, 0x31, 0xdd, 0x0c, 0xa4, 0x67, 0x09,
+  0x7c, 0x90, 0x40, 0xe5, 0x7e, 0x7b, 0x34, 0xa3, 0x52, 0xa9, 0xf2, 0x1f, 0x90, 0xde, 0x45, 0x48,
+  0x8d, 0x6a, 0x3f, 0x35, 0xff, 0x44, 0xa7, 0x77, 0x1b, 0xbd, 0xdc, 0x33, 0xf0, 0x18, 0x3f, 0xb2,
+  0xa7, 0xcc, 0x93, 0x66, 0xb0, 0x70, 0x99, 0xe7, 0xf9, 0x53, 0xe4, 0x3f, 0x21, 0xbf, 0x3e, 0x5f,
+  0xde, 0xc5, 0xd1, 0x74, 0x59, 0xea, 0xfc, 0x82, 0xfd, 0xfc, 0xe0, 0xe1, 0x38, 0x7f, 0x9f, 0xff,
+  0x2a, 0xd5, 0xb8, 0xd8, 0xc3, 0x3f, 0x5e, 0xbd, 0xba, 0xa7, 0xc8, 0x7e, 0x43, 0x79, 0x6f, 0x67,
+  0x43, 0x66, 0xc6, 0xc0, 0xf0, 0x14, 0x8c, 0x6c, 0x6f, 0x2b, 0x43, 0x9e, 0xe7, 0x35, 0xb7, 0xfd,
+  0x16, 0xea, 0xf1, 0x30, 0xa0, 0xfe, 0x7e, 0xb9, 0x35, 0x4f, 0x90, 0xfc, 0x86, 0xff, 0xb8, 0x24,
+  0x8f, 0xf3, 0x92, 0xa1, 0x53, 0x34, 0xbc, 0x3d, 0x8c, 0x13, 0x69, 0x8b, 0xa5, 0x79, 0x25, 0x59,
+  0xbb, 0xdc, 0xa3, 0xaf, 0xe3, 0xe2, 0xc6, 0xaa, 0x6a, 0x9f, 0x21, 0xf9, 0x0d, 0xff, 0x57, 0x09,
+  0x1c, 0x0e, 0x29, 0x1f, 0xe1, 0x4d, 0xb0, 0x50, 0x28, 0x4f, 0x56, 0x5d, 0x8e, 0xae, 0xf0, 0x6e,
+  0x96, 0xec, 0x35, 0x97, 0x65, 0x1f, 0x8c, 0xed, 0xd5, 0x3e, 0x43, 0xf2, 0x1b, 0xfa, 0xfb, 0xf6,
+  0x2a, 0x37, 0x4a, 0xb3, 0xa4, 0xdd, 0xe2, 0xb9, 0x96, 0x6b, 0x37, 0x9a, 0x51, 0xda, 0x81, 0xfb,
+  0xea, 0x75, 0x3c, 0xdd, 0xbb, 0x8f, 0xb3, 0xbf, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xc5, 0xc3, 0xf4,
+  0x18, 0x0c, 0x76, 0xcb, 0x61, 0xf3, 0xcd, 0x74, 0x3b, 0x32, 0x6b, 0x97, 0x5e, 0x33, 0xb2, 0xe5,
+  0x7a, 0xa9, 0xd3, 0x9e, 0xb5, 0xf7, 0x51, 0x6a, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x9d, 0xe0, 0xe7,
+  0x6e, 0x30, 0x6f, 0x46, 0x9f, 0x3f, 0x74, 0xe7, 0x48, 0xfa, 0xd9, 0x3a, 0xe7, 0x6b, 0x19, 0xc5,
+  0xf9, 0x4e, 0x7f, 0xfa, 0xc8, 0x06, 0xe2, 0x72, 0xa9, 0xf2, 0x1f, 0x90, 0xdf, 0xbf, 0xb5, 0x8c,
+  0xf6, 0xff, 0x5b, 0xba, 0x4d, 0xff, 0xad, 0x85, 0x82, 0x4d, 0xa1, 0x37, 0x7e, 0xfd, 0x47, 0x45,
+  0x2c, 0xe9, 0x6b, 0x75, 0xb1, 0x1d, 0x16, 0xb1, 0x53, 0xe4, 0x3f, 0x21, 0xbc, 0x4b, 0x55, 0xd3,
+  0xbe, 0x4b, 0x3d, 0xb5, 0x5a, 0x9e, 0x03, 0x6d, 0x3c, 0x83, 0x65, 0x3d, 0x1e, 0x6e, 0x1c, 0x7e,
+  0xb1, 0xda, 0x81, 0x67, 0x2e, 0x12, 0x8c, 0x12, 0xa7, 0xc8, 0x7e, 0x43, 0x7f, 0xb5, 0x87, 0x19,
+  0x15, 0xad, 0x4f, 0x31, 0x9d, 0xa9, 0xa4, 0x87, 0x15, 0x06, 0xf9, 0xdb, 0xb6, 0x1a, 0x0f, 0xec,
+  0xda, 0x21, 0xbf, 0x9c, 0x77, 0x60, 0xf7, 0xc5, 0x4f, 0x90, 0xfc, 0x86, 0xf4, 0xbc, 0xd4, 0x0e,
+  0xcd, 0x45, 0xb4, 0xeb, 0xba, 0xbb, 0x0c, 0x36, 0xbf, 0xeb, 0xe7, 0xe5, 0xff, 0x75, 0x3f, 0xcc,
+  0x2c, 0xdb, 0x47, 0x40, 0x8b, 0xc0, 0xab, 0x4a, 0x9f, 0x21, 0xf9, 0x0d, 0xfa, 0x11, 0x5f, 0xd4,
+  0xbb, 0x5b, 0x34, 0xbd, 0xc1, 0x36, 0xba, 0x4b, 0x5e, 0x52, 0x61, 0xbc, 0xc6, 0xe7, 0xbb, 0x90,
+  0x78, 0x55, 0xc2, 0xeb, 0xe0, 0xec, 0x77, 0x15, 0x3e, 0x43, 0xf2, 0x1b, 0xd1, 0xb2, 0x52, 0xf9,
+  0x7d, 0x46, 0xb9, 0xb3, 0x93, 0xc0, 0xa7, 0xb7, 0xdd, 0x16, 0x3a, 0x09, 0x1f, 0x9f, 0xd7, 0x2f,
+  0x54, 0xdf, 0x26, 0x5b, 0xeb, 0x48, 0xe1, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xb6, 0xf4, 0x2c, 0x72,
+  0x7f, 0x96, 0x8a, 0x2b, 0xfd, 0xac, 0xc3, 0xf4, 0xde, 0x1e, 0x05, 0x8a, 0xe9, 0x4b, 0x9e, 0xe7,
+  0xb7, 0xdc, 0x0b, 0x2c, 0x66, 0x27, 0xcb, 0x1a, 0x08, 0x00, 0x00, 0x68, 0xcc, 0x41, 0x4e, 0x90,
+  0x5b, 0x6d, 0xf7, 0x4b, 0x4d, 0xbe, 0xdd, 0x20, 0xb3, 0x58, 0x6c, 0x96, 0x59, 0x05, 0xea, 0xdf,
+  0x6e, 0xb2, 0xc8, 0x2e, 0x56, 0x1b, 0x4d, 0xb2, 0xe5, 0x6f, 0xb0, 0xd9, 0x24, 0x16, 0xcb, 0x0d,
+  0xba, 0xe9, 0x65, 0xb9, 0x5b, 0x84, 0x2b, 0x05, 0xc8, 0x55, 0xba, 0xd5, 0x0e, 0x35, 0x8a, 0x8f,
+  0x78, 0xed, 0x69, 0xa1, 0xf8, 0x7c, 0xad, 0x33, 0x07, 0x3f, 0x9a, 0xc7, 0xf8, 0x9a, 0x08, 0x57,
+  0xe3, 0x70, 0x21, 0x92, 0x1f, 0x90, 0xf7, 0x9b, 0x92, 0xe3, 0xff, 0xa5, 0x78, 0x8a, 0xd7, 0x16,
+  0x41, 0x60, 0x9e, 0xfb, 0x74, 0x75, 0xeb, 0x3e, 0x9e, 0x43, 0xfd, 0x97, 0x6b, 0xe1, 0x18, 0xad,
+  0xcd, 0x24, 0xcb, 0xa4, 0x3f, 0x21, 0xce, 0x1b, 0x2b, 0x77, 0xae, 0xd0, 0xf5, 0x1b, 0xc9, 0xbc,
+  0x46, 0xbf, 0x2b, 0x9d, 0xf4, 0xef, 0x98, 0x4b, 0xbe, 0x93, 0x6f, 0xac, 0xa1, 0x57, 0x6a, 0xf1,
+  0x49, 0xf2, 0xa7, 0xc8, 0x7e, 0x43, 0x7f, 0x85, 0x6a, 0x4d, 0xb4, 0xab, 0xf9, 0x69, 0x35, 0xc8,
+  0x56, 0x62, 0x5f, 0xb8, 0xec, 0xec, 0x6c, 0x9b, 0x2c, 0x44, 0x8a, 0xb1, 0x3d, 0xaf, 0x4c, 0x79,
+  0x55, 0x65, 0x4f, 0x90, 0xfc, 0x86, 0xfc, 0xad, 0x0e, 0x53, 0x87, 0x28, 0x80, 0x70, 0x7e, 0xbc,
+  0xce, 0x5c, 0x2a, 0x4d, 0x73, 0xdd, 0xf1, 0xe3, 0x38, 0xd8, 0x07, 0xd2, 0xc1, 0xcc, 0xed, 0x66,
+  0xea, 0x4a, 0x9f, 0x21, 0xf9, 0x0d, 0xfa, 0xd2, 0xac, 0x05, 0x2a, 0xed, 0xb8, 0xf2, 0x70, 0xa2,
+  0xfb, 0x7b, 0xe5, 0x0e, 0xc5, 0x5b, 0xb6, 0xdb, 0x2e, 0x70, 0xf9, 0xf5, 0xaa, 0xcf, 0x10, 0xa3,
+  0x7c, 0x95, 0x3e, 0x43, 0xf2, 0x1b, 0xf4, 0xb6, 0xba, 0xc8, 0x44, 0x03, 0x9f, 0x72, 0xc1, 0xea,
+  0xe3, 0xb4, 0x4e, 0x7d, 0x96, 0xa3, 0x15, 0xb5, 0xfe, 0x62, 0x1f, 0x78, 0xef, 0xbf, 0x29, 0x8c,
+  0xfa, 0xaa, 0x7c, 0x87, 0xe4, 0x37, 0xbf, 0xc0, 0x7a, 0xbb, 0xec, 0x3c, 0x0e, 0x55, 0xf7, 0xa3,
+  0xef, 0x64, 0x98, 0xc9, 0xf5, 0x73, 0x01, 0xd5, 0xf0, 0x70, 0xfb, 0xd3, 0x69, 0x1c, 0x96, 0x5b,
+  0x1d, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x9c, 0xe7, 0xef, 0xa5, 0x9c, 0xb8, 0xaf, 0x37, 0xbf, 0xac,
+  0xab, 0xf6, 0xa7, 0x1a, 0xb9, 0xed, 0xba, 0xd7, 0xe8, 0xf3, 0xed, 0x6f, 0x1c, 0x4c, 0x2f, 0xa6,
+  0x50, 0xa9, 0xf2, 0x1f, 0x90, 0xdf, 0xd5, 0xde, 0x93, 0x44, 0x71, 0x9c, 0x58, 0xdf, 0xef, 0x35,
+  0xaa, 0x93, 0xe5, 0x2d, 0xbb, 0x4c, 0xf7, 0xb7, 0xa1, 0x3d, 0x9d, 0x68, 0xb2, 0x57, 0x2b, 0xff,
+  0x59, 0x53, 0xe4, 0x3f, 0x21, 0xbc, 0xab, 0xe1, 0xcc, 0x97, 0x62, 0xba, 0x5d, 0x38, 0x57, 0x46,
+  0xf1, 0xca, 0xb0, 0x50, 0xf0, 0x3d, 0x28, 0xd5, 0x67, 0x0b, 0x2e, 0xb9, 0xd3, 0x75, 0xbb, 0x0f,
+  0x4a, 0xa7, 0xc8, 0x7e, 0x43, 0x78, 0xcf, 0x0e, 0xe3, 0x43, 0xc2, 0x7f, 0x76, 0xdc, 0xe8, 0x85,
+  0xff, 0x09, 0x5b, 0xf7, 0xd8, 0xf9, 0x1b, 0x4a, 0x1d, 0xfe, 0xa1, 0xac, 0xda, 0x7d, 0x67, 0x91,
+  0xf5, 0x4f, 0x90, 0xfc, 0x86, 0xf7, 0xa8, 0xc7, 0x52, 0x21, 0x3b, 0x83, 0x61, 0x20, 0xb1, 0x8b,
+  0xfc, 0x56, 0x8d, 0x2f, 0x8d, 0xd0, 0x6f, 0x34, 0xef, 0x55, 0x8a, 0x19, 0x89, 0x86, 0x78, 0xe7,
+  0x2a, 0x9f, 0x21, 0xf9, 0x0d, 0xe1, 0x7a, 0xfd, 0xbd, 0x56, 0xdf, 0xad, 0xfe, 0xdc, 0x35, 0x33,
+  0xa9, 0xef, 0x87, 0x87, 0x69, 0xfe, 0x4a, 0xa7, 0x58, 0x79, 0x15, 0x57, 0x15, 0xb0, 0xb2, 0x7d,
+  0xd5, 0x3e, 0x43, 0xf2, 0x1b, 0xe3, 0x68, 0xfd, 0x8e, 0x8f, 0x7f, 0x65, 0xe1, 0xe7, 0x60, 0xed,
+  0xdb, 0xcf, 0x65, 0xb6, 0x1b, 0xbb, 0xc3, 0x71, 0xa2, 0xd5, 0x1a, 0x2d, 0xdf, 0x45, 0x81, 0x8c,
+  0xaa, 0x7c, 0x87, 0xe4, 0x37, 0xe0, 0x68, 0xbf, 0x14, 0x5a, 0x67, 0x53, 0xdf, 0xe1, 0xb2, 0xf7,
+  0x2a, 0x32, 0x7f, 0x5f, 0x1e, 0x79, 0x4f, 0xd9, 0xd5, 0xf5, 0xd9, 0xd8, 0x96, 0x8b, 0xef, 0x5e,
+  0x54, 0xf9, 0x0f, 0xc8, 0x71, 0x7e, 0xeb, 0xdc, 0x6e, 0xdd, 0x4f, 0x45, 0x9e, 0x23, 0x44, 0xde,
+  0xd4, 0x7f, 0xd5, 0x69, 0xfd, 0x0f, 0x83, 0x09, 0xfd, 0xc7, 0x63, 0x36, 0xfc, 0x4e, 0x1d, 0x53,
+  0xe4, 0x3f, 0x21, 0xbc, 0xe3, 0x37, 0x34, 0x8a, 0x47, 0x6e, 0x58, 0xb9, 0x0d, 0x16, 0xcb, 0xc0,
+  0x95, 0xd9, 0xaf, 0x78, 0x69, 0x16, 0xbf, 0xdd, 0xf6, 0xc2, 0x53, 0x79, 0x5f, 0x6a, 0xa2, 0xa7,
+  0xc8, 0x7e, 0x43, 0x7f, 0xee, 0xef, 0xa1, 0xef, 0x80, 0xdb, 0x73, 0x5c, 0xee, 0x0c, 0x02, 0x33,
+  0x74, 0xf1, 0xfd, 0x79, 0xfa, 0xe9, 0xf7, 0x0e, 0xc1, 0x93, 0xb7, 0x5c, 0xff, 0xb8, 0x45, 0x4f,
+  0x90, 0xfc, 0x86, 0xf7, 0x3c, 0xe5, 0xaf, 0x85, 0xe1, 0xc3, 0x74, 0xe6, 0x14, 0x7e, 0xae, 0x2b,
+  0xdd, 0x34, 0xc3, 0x76, 0xf4, 0xb2, 0xea, 0x5f, 0xe2, 0x15, 0x3b, 0x95, 0x57, 0xfb, 0x2a, 0x9f,
+  0x21, 0xf9, 0x0d, 0xeb, 0x3f, 0xfe, 0x2d, 0x36, 0xfd, 0x7d, 0xfb, 0xc1, 0x72, 0xba, 0x4e, 0x8d,
+  0x5e, 0x35, 0xec, 0xb5, 0x72, 0x27, 0xf4, 0x5c, 0x06, 0xa6, 0xeb, 0xae, 0xed, 0xc4, 0x55, 0x3e,
+  0x43, 0xf2, 0x1b, 0xdc, 0x74, 0x99, 0xda, 0x86, 0x62, 0x25, 0xc6, 0x87, 0x5b, 0x25, 0x9a, 0xeb,
+  0x85, 0x57, 0xd1, 0x3c, 0xeb, 0xcc, 0x6e, 0x1b, 0x69, 0x7f, 0x73, 0x81, 0x33, 0xf6, 0xaa, 0x7c,
+  0x87, 0xe4, 0x37, 0xbc, 0xd2, 0xb6, 0xb8, 0xaf, 0x74, 0x13, 0xff, 0x0a, 0xc5, 0xcb, 0xbc, 0x7f,
+  0x9d, 0x2c, 0xea, 0x21, 0x92, 0xe1, 0xe3, 0x6b, 0x75, 0xe9, 0x84, 0x82, 0x4b, 0x2c, 0x54, 0xf9,
+  0x0f, 0xc8, 0x6f, 0x32, 0xd9, 0x72, 0xf7, 0x94, 0x18, 0xad, 0x93, 0x77, 0xb4, 0xb5, 0x4b, 0xb6,
+  0x3c, 0x9d, 0x0e, 0x9f, 0x71, 0xb6, 0xad, 0xcb, 0xbe, 0x93, 0x0c, 0x75, 0xcb, 0x1e, 0xa9, 0xf2,
+  0x1f, 0x90, 0xde, 0xb7, 0x9c, 0xcf, 0xe9, 0xaa, 0x30, 0x3d, 0x9f, 0x7f, 0x4b, 0xa0, 0xa8, 0x56,
+  0xb0, 0x5d, 0xee, 0x0c, 0x2b, 0x95, 0x9c, 0xf8, 0xec, 0x73, 0xbc, 0x9e, 0xd7, 0x59, 0x53, 0xe4,
+  0x3f, 0x21, 0xbe, 0xdb, 0x91, 0xf3, 0x83, 0xf7, 0xb1, 0xda, 0xc9, 0xbc, 0x7f, 0x21, 0x09, 0xd9,
+  0x64, 0x36, 0x31, 0xea, 0x46, 0xfa, 0x1d, 0x62, 0xab, 0xcd, 0xf2, 0x51, 0xce, 0x0a, 0xa7, 0xc8,
+  0x7e, 0x43, 0x78, 0x0f, 0xdb, 0x0b, 0xa0, 0xd4, 0x5e, 0x22, 0x38, 0x2f, 0x17, 0xe6, 0x33, 0x79,
+  0xd9, 0xf6, 0xaf, 0xb3, 0x2a, 0xa5, 0xca, 0x85, 0xa4, 0xdf, 0x6a, 0x7f, 0x31, 0x05, 0x4f, 0x90,
+  0xfc, 0x86, 0xff, 0xdf, 0x2c, 0x5a, 0x63, 0x6e, 0xbf, 0xe8, 0x30, 0x5a, 0xdc, 0xe4, 0xfe, 0xe3,
+  0xaa, 0x8c, 0x67, 0xf0, 0xf4, 0xac, 0x3d, 0x42, 0xb3, 0xf1, 0xe7, 0x4c, 0x70, 0x4a, 0x9f, 0x21,
+  0xf9, 0x0d, 0xed, 0x35, 0x6b, 0x2d, 0xeb, 0xe3, 0x64, 0x8d, 0x7d, 0x68, 0x33, 0x89, 0xe5, 0x62,
+  0x6d, 0x2c, 0xa2, 0x42, 0x2c, 0x10, 0xfa, 0x74, 0xdb, 0x25, 0xc0, 0xc2, 0x76, 0x15, 0x3e, 0x43,
+  0xf2, 0x1b, 0xc1, 0xa1, 0x33, 0x49, 0xdf, 0xc7, 0xcf, 0x3f, 0xce, 0x57, 0xb1, 0xfd, 0x0f, 0x7c,
+  0x5f, 0xad, 0x2b, 0xba, 0xd6, 0x39, 0x1f, 0xaf, 0xd5, 0x7e, 0x81, 0xb1, 0xe9, 0x2a, 0x7c, 0x87,
+  0xe4, 0x37, 0xca, 0x6f, 0x68, 0x33, 0x39, 0x6f, 0x1f, 0x9d, 0x36, 0xe2, 0x57, 0xf7, 0x5f, 0x68,
+  0x67, 0x5a, 0x2d, 0x8e, 0xf8, 0x5c, 0xe2, 0xb6, 0x68, 0xc4, 0x3a, 0xf3, 0x30, 0x54, 0xf9, 0x0f,
+  0xc8, 0x6f, 0xd3, 0x99, 0xd3, 0x64, 0x76, 0x6e, 0x2e, 0x27, 0x0b, 0x32, 0xb4, 0xef, 0x25, 0x9d,
+  0x7f, 0x67, 0x0e, 0x25, 0xe9, 0xe8, 0x57, 0xa7, 0x57, 0xff, 0x56, 0x73, 0x62, 0xa9, 0xf2, 0x1f,
+  0x90, 0xdf, 0x07, 0x2b, 0x8c, 0x72, 0xeb, 0x9a, 0x19, 0x75, 0x1e, 0xd3, 0x6d, 0xca, 0x54, 0xa6,
+  0xdd, 0x7f, 0x9f, 0x0a, 0x07, 0x9e, 0xcb, 0xcd, 0xaa, 0x59, 0x3e, 0xd4, 0x59, 0x53, 0xe4, 0x3f,
+  0x21, 0xbd, 0x8e, 0xcb, 0x61, 0xf5, 0x73, 0xe3, 0x77, 0xd9, 0xec, 0xa6, 0x55, 0x02, 0x94, 0x7a,
+  0xab, 0x16, 0x5a, 0xf7, 0xf7, 0x3d, 0x7e, 0x8c, 0xd4, 0xb9, 0x7f, 0x28, 0xfa, 0xa7, 0xc8, 0x7e,
+  0x43, 0x79, 0xa6, 0x87, 0xd3, 0x41, 0xbf, 0xfc, 0xe7, 0x12, 0x69, 0x95, 0x87, 0x91, 0x6e, 0xd9,
+  0x4b, 0xbb, 0x7a, 0x5c, 0xce, 0x43, 0xa9, 0xa4, 0x9f, 0x54, 0x34, 0xd8, 0xb5, 0x4f, 0x90, 0xfc,
+  0x86, 0xfb, 0x6c, 0xf5, 0xc3, 0x21, 0x2b, 0xf4, 0x47, 0x78, 0x94, 0x3e, 0x96, 0x93, 0xc9, 0x50,
+  0x8d, 0xc4, 0xeb, 0x39, 0x59, 0xa5, 0x63, 0x2f, 0xd8, 0xf1, 0x6c, 0xe3, 0x8a, 0x9f, 0x21, 0xf9,
+  0x0d, 0xf5, 0x31, 0xdd, 0xb6, 0x5f, 0x29, 0xbb, 0xf6, 0xf5, 0x63, 0xb3, 0xda, 0xbd, 0x27, 0x05,
+  0xdd, 0xe7, 0x4e, 0x36, 0x34, 0x9e, 0x66, 0xcb, 0xbd, 0x43, 0xee, 0x64, 0x15, 0x3e, 0x43, 0xf2,
+  0x1b, 0xf3, 0x3b, 0xb7, 0xa8, 0xb5, 0xea, 0x57, 0x68, 0x8d, 0x60, 0x2c, 0x5a, 0x1a, 0xf4, 0x26,
+  0x6b, 0xcb, 0x81, 0xeb, 0xf2, 0x1e, 0xed, 0xac, 0x46, 0x63, 0xe0, 0xd3, 0xaa, 0x7c, 0x87, 0xe4,
+  0x37, 0xf0, 0x68, 0x2f, 0xdc, 0xcc, 0xe7, 0xea, 0x9b, 0x52, 0x96, 0x40, 0x28, 0x5e, 0x2d, 0x27,
+  0x8f, 0x97, 0x79, 0xa6, 0xf2, 0x6f, 0xf5, 0xf9, 0x8d, 0xb6, 0xfd, 0x23, 0x54, 0xf9, 0x0f, 0xc8,
+  0x6f, 0xa5, 0x92, 0x60, 0x2f, 0x5b, 0xbf, 0x35, 0x76, 0x7f, 0xe0, 0xec, 0x7e, 0x72, 0xf1, 0x5d,
+  0x36, 0x3e, 0xb9, 0x4c, 0xda, 0x4f, 0xae, 0x3f, 0xdd, 0xb5, 0xdf, 0x84, 0xa9, 0xf2, 0x1f, 0x90,
+  0xdf, 0xb5, 0x2a, 0xa0, 0x78, 0x32, 0xfb, 0x0a, 0xc6, 0x7e, 0xbd, 0xa9, 0xc3, 0xce, 0xe3, 0x53,
+  0xfe, 0xa5, 0xaa, 0xd9, 0x10, 0xf6, 0xea, 0xa6, 0xdc, 0xec, 0x55, 0x15, 0x53, 0xe4, 0x3f, 0x21,
+  0xbd, 0x06, 0xe5, 0x80, 0xde, 0xfc, 0x23, 0x1f, 0xe9, 0x9d, 0x92, 0x6b, 0xac, 0xc7, 0xdc, 0xed,
+  0xd5, 0xdb, 0x25, 0xb3, 0x3f, 0x4a, 0xe6, 0x67, 0x2e, 0x77, 0x9b, 0x62, 0xa7, 0xc8, 0x7e, 0x43,
+  0x7c, 0xc6, 0xef, 0xfd, 0xd3, 0xc3, 0x77, 0x61, 0xfb, 0xad, 0x94, 0xea, 0x4f, 0x53, 0xf1, 0x7c,
+  0xfd, 0x10, 0x98, 0x74, 0x7e, 0x2d, 0x95, 0xf7, 0xd9, 0xa0, 0x5f, 0x75, 0x4f, 0x90, 0xfc, 0x86,
+  0xfa, 0x0e, 0x3d, 0xef, 0xc1, 0x18, 0xe0, 0x52, 0xbe, 0xd0, 0xab, 0xce, 0xe6, 0x8d, 0x25, 0xc6,
+  0xcd, 0xa3, 0x51, 0x0a, 0x84, 0x43, 0x8d, 0xee, 0xb3, 0x79, 0xb4, 0xaa, 0x9f, 0x21, 0xf9, 0x0d,
+  0xe3, 0x15, 0x4d, 0xbe, 0x92, 0xcf, 0x81, 0xb8, 0x69, 0x65, 0x5b, 0x29, 0x14, 0xab, 0xfb, 0xfd,
+  0x83, 0xd6, 0x26, 0x7f, 0x4f, 0xd4, 0x7e, 0xb7, 0x35, 0xf2, 0xcd, 0xd5, 0x3e, 0x43, 0xf2, 0x1b,
+  0xf0, 0xa4, 0x57, 0x1f, 0x0c, 0xcf, 0xc1, 0x41, 0xc4, 0x74, 0xf4, 0x92, 0x2d, 0xec, 0xaa, 0x07,
+  0x1b, 0xc0, 0x4d, 0xb9, 0x39, 0x2a, 0xff, 0xcf, 0x23, 0xbe, 0xb6, 0xaa, 0x7c, 0x87, 0xe4, 0x37,
+  0xae, 0x7c, 0xed, 0x55, 0x59, 0xde, 0x76, 0xf9, 0x5e, 0xe2, 0x44, 0x2f, 0x3b, 0xfb, 0x65, 0x7e,
+  0x63, 0x55, 0xed, 0x64, 0x33, 0x34, 0x7b, 0xcc, 0xee, 0x65, 0x06, 0x54, 0xf9, 0x0f, 0xc8, 0x6f,
+  0xa6, 0xc2, 0xd8, 0xb8, 0x34, 0x0b, 0xbf, 0x8b, 0xd3, 0xbf, 0xdb, 0x79, 0xbe, 0x58, 0x2e, 0x8c,
+  0x2b, 0x2b, 0xdf, 0x84, 0x73, 0xb2, 0xfa, 0xcf, 0x9c, 0x07, 0x88, 0xa9, 0xf2, 0x1f, 0x90, 0xde,
+  0xc5, 0x99, 0x8c, 0xf9, 0x60, 0x52, 0xf9, 0x9f, 0x9f, 0x05, 0x56, 0x95, 0x45, 0x25, 0xb1, 0x8b,
+  0x34, 0x06, 0x0b, 0xf3, 0xf9, 0xc3, 0xe9, 0x77, 0x8f, 0x5d, 0x95, 0x53, 0xe4, 0x3f, 0x21, 0xbd,
+  0x3b, 0xdf, 0x4e, 0xc0, 0x50, 0x70, 0xb2, 0xf8, 0xcf, 0x3b, 0x5f, 0x05, 0xf3, 0x4b, 0x7e, 0xb0,
+  0x5a, 0xcc, 0x32, 0x1f, 0xc6, 0xb7, 0x45, 0xf1, 0x7a, 0xfd, 0x52, 0xa7, 0xc8, 0x7e, 0x43, 0x79,
+  0x5d, 0x1b, 0x85, 0x54, 0xde, 0x4e, 0x32, 0xd3, 0xeb, 0x1e, 0x0e, 0x6d, 0x28, 0xa1, 0x49, 0xf4,
+  0xd5, 0xdd, 0x9c, 0x76, 0x11, 0x76, 0xe7, 0xfb, 0x21, 0xd5, 0x25, 0x4f, 0x90, 0xfc, 0x86, 0xfb,
+  0x9b, 0x04, 0xd6, 0x3f, 0x35, 0x84, 0xc9, 0xe2, 0xf0, 0x0c, 0x85, 0xff, 0x33, 0x2b, 0xb8, 0x42,
+  0xb9, 0x9b, 0xbe, 0xed, 0xe3, 0xcb, 0x35, 0xad, 0xf2, 0x23, 0xca, 0x9f, 0x21, 0xf9, 0x0d, 0xf7,
+  0x1f, 0xab, 0x3e, 0x86, 0xd5, 0xb8, 0xd1, 0xd9, 0x6c, 0xd9, 0x6c, 0xf7, 0xeb, 0x53, 0x8e, 0xf8,
+  0xd9, 0xfc, 0x90, 0xee, 0xc5, 0xee, 0x0f, 0x97, 0xce, 0xf3, 0x95, 0x3e, 0x43, 0xf2, 0x1b, 0xf9,
+  0xfa, 0xf1, 0x7c, 0xe4, 0x6e, 0x0b, 0xca, 0xf2, 0xd5, 0x6a, 0xf5, 0x48, 0x5d, 0xf2, 0x85, 0x1a,
+  0xf7, 0x7b, 0x6e, 0x3e, 0x6f, 0xd4, 0x1a, 0xc3, 0x4c, 0x91, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0x83,
+  0xed, 0xa0, 0xfc, 0xe8, 0x56, 0xbe, 0xb7, 0x5a, 0xc6, 0xe4, 0x6c, 0x18, 0xcb, 0x25, 0x32, 0x8f,
+  0x21, 0xcb, 0xf1, 0xac, 0x72, 0x0f, 0x95, 0xe7, 0x2f, 0xda, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0xd8,
+  0xab, 0x7d, 0x7f, 0x1f, 0x5b, 0xc4, 0x5f, 0x05, 0xcd, 0x82, 0xe0, 0xe7, 0xb2, 0x0b, 0x5c, 0xdb,
+  0x7f, 0xa2, 0xe6, 0xc3, 0xb5, 0xd8, 0xac, 0xfc, 0xef, 0x6a, 0xa9, 0xf2, 0x1f, 0x90, 0xde, 0x35,
+  0x78, 0xd0, 0xf6, 0xb3, 0xb1, 0xed, 0xf4, 0x7f, 0xad, 0x73, 0xbe, 0xf7, 0x6e, 0x36, 0x0d, 0x46,
+  0x27, 0x9d, 0x45, 0xd4, 0xd9, 0x31, 0xf9, 0x2f, 0xdd, 0xd1, 0x53, 0xe4, 0x3f, 0x21, 0xbe, 0x33,
+  0xb9, 0xcd, 0x99, 0xf0, 0xac, 0x31, 0x0f, 0x75, 0xa3, 0x35, 0x0e, 0x96, 0xc5, 0xfd, 0x75, 0xc9,
+  0xff, 0x6f, 0xdf, 0xf2, 0x80, 0xf0, 0x62, 0x79, 0x6e, 0xba, 0xa7, 0xc8, 0x7e, 0x43, 0x7f, 0x7d,
+  0x06, 0x6f, 0xc5, 0x91, 0xc0, 0xf9, 0x9b, 0x2a, 0x1c, 0xef, 0xed, 0xed, 0xe8, 0xf3, 0x22, 0x9a,
+  0x0c, 0x46, 0x2f, 0x55, 0x46, 0xf0, 0x78, 0xb9, 0x79, 0xe5, 0x4f, 0x90, 0xfc, 0x86, 0xf0, 0x3b,
+  0x46, 0x82, 0x9d, 0x82, 0xe1, 0x6d, 0x25, 0x32, 0x68, 0xb7, 0xd3, 0xb9, 0x61, 0xe1, 0x63, 0xad,
+  0xd9, 0x6e, 0xce, 0x43, 0xe7, 0xab, 0xdf, 0xd6, 0xf1, 0x0a, 0x9f, 0x21, 0xf9, 0x0d, 0xf0, 0xf1,
+  0x1e, 0x46, 0x3b, 0x3b, 0x5f, 0xc3, 0x45, 0x7a, 0x5e, 0xbe, 0x4e, 0xef, 0x0b, 0x8e, 0xc5, 0x59,
+  0xf8, 0xb9, 0x8b, 0x37, 0x23, 0xc7, 0x69, 0x82, 0xd5, 0x95, 0x3e, 0x43, 0xf2, 0x1b, 0xcf, 0x7f,
+  0x96, 0xea, 0x3c, 0xd3, 0x35, 0x02, 0x99, 0xc1, 0xef, 0x33, 0x5a, 0x57, 0xfb, 0xe1, 0xca, 0xa6,
+  0x75, 0x31, 0x5e, 0xac, 0x25, 0x23, 0x43, 0x8b, 0xe4, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xf1, 0xfa,
+  0x6a, 0x73, 0x78, 0x4c, 0xcb, 0xd5, 0x46, 0xc2, 0xe0, 0xbe, 0xf4, 0x9c, 0x5e, 0xa2, 0x19, 0xdc,
+  0xc2, 0x5b, 0x3b, 0xbe, 0x8c, 0xd4, 0x9f, 0x57, 0x9d, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x3a, 0xcb,
+  0xcd, 0xe3, 0xfd, 0xaf, 0x47, 0xf2, 0x19, 0x0b, 0xe2, 0x74, 0x6e, 0xfe, 0xeb, 0xb4, 0x47, 0xb3,
+  0x95, 0x80, 0xff, 0xb6, 0x99, 0x8d, 0xdc, 0x9b, 0x2e, 0xa0, 0x03, 0x00, 0x00, 0xc5, 0x24, 0xc4,
+  0xbf, 0xb2, 0xc8, 0x2e, 0x56, 0x1b, 0x4d, 0xb2, 0xe5, 0x6f, 0xb0, 0xd9, 0x24, 0x16, 0xcb, 0x0d,
+  0xba, 0xe9, 0x65, 0xb9, 0x5b, 0xa4, 0x16, 0xdb, 0x7d, 0xd2, 0xd3, 0x6f, 0xb7, 0x48, 0x2c, 0xd6,
+  0x1b, 0x25, 0x96, 0x41, 0x7a, 0xb7, 0xdb, 0x84, 0x2b, 0x01, 0xe3, 0xf6, 0xb7, 0xf6, 0x8b, 0xe7,
+  0xe6, 0x8f, 0x5b, 0xff, 0xe0, 0x72, 0xde, 0x58, 0xce, 0x66, 0x03, 0xc7, 0x84, 0x43, 0xf5, 0x10,
+  0x48, 0xe6, 0xf2, 0xe8, 0x21, 0x92, 0x1f, 0x90, 0xf7, 0xf5, 0x39, 0xfd, 0xf5, 0xae, 0x7a, 0xed,
+  0x0e, 0xd2, 0x67, 0xf5, 0xe3, 0xd9, 0x26, 0x35, 0x2b, 0x24, 0x57, 0xb5, 0x40, 0xe7, 0x61, 0x33,
+  0x90, 0xc9, 0x67, 0xd0, 0xcb, 0xa4, 0x3f, 0x21, 0xcf, 0x8f, 0x59, 0x5b, 0x93, 0x6e, 0xa7, 0xbb,
+  0x38, 0xb5, 0x4e, 0xc9, 0x65, 0xd0, 0xe4, 0x7c, 0x13, 0x1e, 0xa6, 0x36, 0xd5, 0xfc, 0x83, 0xc8,
+  0x29, 0x13, 0x7e, 0xca, 0xa7, 0xc8, 0x7e, 0x43, 0x7b, 0xe7, 0x87, 0x75, 0x6d, 0xff, 0xfa, 0xfe,
+  0x32, 0xbb, 0xec, 0x36, 0x33, 0x0f, 0xe3, 0xe1, 0x78, 0x3f, 0xfd, 0x0d, 0x16, 0xb1, 0xf2, 0xa9,
+  0x64, 0xf3, 0xbe, 0x15, 0x4f, 0x90, 0xfc, 0x86, 0xf8, 0x7c, 0xc7, 0x62, 0xd7, 0x00, 0xbb, 0x46,
+  0x76, 0x96, 0xfd, 0x86, 0x92, 0xd9, 0x91, 0xff, 0xf5, 0x2a, 0xfd, 0x6c, 0x9e, 0x92, 0x09, 0xf0,
+  0xd6, 0x47, 0xb9, 0xaa, 0x9f, 0x21, 0xf9, 0x0d, 0xf8, 0x59, 0x1b, 0xaf, 0x8a, 0xfb, 0x9e, 0xf5,
+  0xdc, 0x7d, 0x50, 0xce, 0x35, 0xe7, 0x5f, 0x0f, 0x95, 0x66, 0x7d, 0x71, 0x2c, 0xf7, 0xff, 0x77,
+  0x52, 0xbc, 0xd7, 0x55, 0x3e, 0x43, 0xf2, 0x1b, 0xfb, 0xb1, 0x75, 0x0c, 0x84, 0xe2, 0x4b, 0x29,
+  0x91, 0x6b, 0x7c, 0x53, 0xff, 0xb7, 0x8e, 0xeb, 0x82, 0xc4, 0x68, 0xb0, 0x70, 0x7d, 0x0d, 0xce,
+  0x8d, 0x6f, 0xa8, 0xaa, 0x7c, 0x87, 0xe4, 0x37, 0xe5, 0xd2, 0x25, 0x53, 0x6f, 0x7f, 0x27, 0x23,
+  0x86, 0xbd, 0x7c, 0xb9, 0xda, 0x2f, 0x5f, 0xc3, 0x3b, 0xe2, 0xdc, 0xe9, 0xb3, 0xda, 0xbe, 0xbd,
+  0x1f, 0x81, 0x68, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x19, 0xc3, 0x70, 0xb2, 0x96, 0x3a, 0x5f, 0x92,
+  0xbd, 0x0f, 0xfe, 0x4d, 0x27, 0xd8, 0x8a, 0x0c, 0xee, 0xd1, 0xf0, 0x9d, 0x49, 0x7b, 0xba, 0x88,
+  0xbc, 0xb2, 0xc6, 0xa9, 0xf2, 0x1f, 0x90, 0xdf, 0x2f, 0x05, 0xed, 0x5a, 0x6a, 0x96, 0xbf, 0x15,
+  0xaa, 0x5b, 0xbf, 0x98, 0xe2, 0xaf, 0x52, 0x88, 0xe7, 0x6a, 0x13, 0x00, 0xad, 0x7d, 0xb4, 0xd7,
+  0x4b, 0x94, 0x09, 0x53, 0xe4, 0x3f, 0x21, 0xbc, 0x1b, 0x0f, 0x30, 0xbb, 0xe0, 0x7d, 0x14, 0xab,
+  0x56, 0x53, 0xf9, 0x84, 0xa3, 0x60, 0x6c, 0xbf, 0xff, 0xc7, 0x0b, 0x71, 0xfe, 0xdb, 0xe4, 0x63,
+  0xf5, 0x48, 0x22, 0xa7, 0xc8, 0x7e, 0x43, 0x79, 0x37, 0x2b, 0x0b, 0x7c, 0xd6, 0x60, 0xfb, 0xb1,
+  0xd8, 0x1d, 0xcf, 0xdf, 0x32, 0xae, 0x6d, 0xf4, 0xb8, 0x1e, 0xe4, 0x8b, 0xa1, 0xe0, 0x94, 0x75,
+  0xf1, 0xf2, 0xb5, 0x4f, 0x90, 0xfc, 0x86, 0xfb, 0x7c, 0x7e, 0x66, 0x71, 0x93, 0xfe, 0x56, 0xe8,
+  0x93, 0xbf, 0x24, 0xc2, 0x1b, 0xcc, 0xef, 0xf3, 0xa6, 0xd1, 0x7f, 0xee, 0x4a, 0x63, 0x2c, 0xaf,
+  0x79, 0xa6, 0xaa, 0x9f, 0x21, 0xf9, 0x0d, 0xef, 0x19, 0x69, 0x5d, 0xb7, 0xed, 0x13, 0xc2, 0x67,
+  0xff, 0x90, 0xf8, 0x3e, 0x63, 0x23, 0x9d, 0x9c, 0xf5, 0xe6, 0x50, 0xa8, 0x15, 0xa6, 0xbb, 0x72,
+  0x8c, 0x78, 0xd5, 0x3e, 0x43, 0xf2, 0x1b, 0xca, 0xb3, 0xdf, 0xce, 0xce, 0x5f, 0x11, 0x18, 0xf7,
+  0x41, 0xb6, 0x73, 0x6c, 0x9d, 0xaf, 0x63, 0xa8, 0x92, 0x7b, 0xe1, 0x3e, 0x1a, 0x55, 0xef, 0xa9,
+  0xe4, 0xfa, 0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xc6, 0xda, 0x79, 0x93, 0xd9, 0xa4, 0x6b, 0xad, 0xf0,
+  0x8c, 0x64, 0x6f, 0x7b, 0xd8, 0xcf, 0x6b, 0xb3, 0xdc, 0x86, 0x6e, 0xbd, 0xd9, 0x1a, 0x2d, 0x12,
+  0x17, 0x29, 0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x60, 0xda, 0xd6, 0xeb, 0x38, 0xec, 0x55, 0xfe, 0xcd,
+  0xf3, 0xb4, 0x65, 0xfa, 0xf5, 0xce, 0xd6, 0x37, 0x81, 0x49, 0xee, 0x7a, 0xe0, 0x37, 0xdc, 0x0d,
+  0x32, 0x84, 0xa9, 0xf2, 0x1f, 0x90, 0xde, 0xcb, 0x42, 0xb4, 0x7b, 0x6c, 0xb9, 0x7e, 0x9c, 0x42,
+  0xaf, 0xfa, 0xa5, 0x68, 0x7e, 0x96, 0xfc, 0x1e, 0x42, 0xd1, 0x30, 0xcb, 0x56, 0x7c, 0x34, 0xcb,
+  0x4f, 0xfd, 0x53, 0xe4, 0x3f, 0x21, 0xbd, 0x6b, 0xa5, 0xb5, 0xdc, 0x5e, 0x20, 0x79, 0x1d, 0x74,
+  0x12, 0x0b, 0x54, 0xed, 0xe8, 0x6b, 0x37, 0xd8, 0x5c, 0x9e, 0xed, 0xb0, 0xac, 0x4c, 0x6c, 0xb2,
+  0x05, 0x4f, 0x90, 0xfc, 0x87, 0x10, 0x09, 0x1f, 0xfe, 0xf7, 0x89, 0xc6, 0x5e, 0xbf, 0xfb, 0x9a,
+  0x55, 0xd2, 0x89, 0x22, 0xad, 0x4e, 0x7e, 0x74, 0x7b, 0x77, 0xe3, 0x7f, 0x2f, 0xc6, 0x4c, 0xac,
+  0x8a, 0x9f, 0x21, 0xf9, 0x0d, 0xe2, 0xdf, 0x68, 0x4f, 0xda, 0xad, 0xf3, 0xa7, 0x71, 0x26, 0xf8,
+  0x9b, 0x5e, 0x7a, 0x71, 0x30, 0xbb, 0xc1, 0xb1, 0x1d, 0x79, 0x85, 0x37, 0x33, 0x80, 0xaf, 0xe3,
+  0x15, 0x3e, 0x43, 0xf2, 0x1b, 0xd7, 0xa1, 0x79, 0x2f, 0x46, 0x7f, 0xf1, 0xcd, 0xde, 0xcf, 0xb0,
+  0x3f, 0x9d, 0x3e, 0x8f, 0x39, 0xf9, 0x82, 0xea, 0x6e, 0x71, 0x6e, 0x24, 0xc2, 0x05, 0x66, 0xac,
+  0x2a, 0x7c, 0x87, 0xe4, 0x37, 0xcb, 0x48, 0x6b, 0x31, 0x29, 0x35, 0x6b, 0x6f, 0xaa, 0xc7, 0x7c,
+  0xfb, 0xb1, 0xf9, 0x15, 0x7a, 0xfb, 0xaf, 0xb6, 0x40, 0x2d, 0x7e, 0x2d, 0x9f, 0x4a, 0x11, 0x88,
+  0x54, 0xf9, 0x0f, 0xc8, 0x6f, 0x7e, 0xfc, 0xc7, 0xe6, 0x9a, 0x9e, 0xdf, 0x2e, 0x95, 0xe6, 0xcf,
+  0xf6, 0x39, 0x17, 0x79, 0xaf, 0x13, 0x8d, 0x8f, 0x9f, 0x7b, 0xed, 0x1e, 0x4d, 0x84, 0x17, 0xb6,
+  0xa9, 0xf2, 0x1f, 0x90, 0xdf, 0xb1, 0x53, 0xd1, 0xc3, 0xbd, 0x33, 0x9e, 0x55, 0x7a, 0x11, 0x45,
+  0xd5, 0x58, 0x2c, 0x1e, 0x2c, 0x74, 0x23, 0xa5, 0xef, 0xb0, 0xc5, 0xb0, 0x35, 0xb8, 0xec, 0x49,
+  0x53, 0xe4, 0x3f, 0x21, 0xbd, 0x8b, 0xdf, 0xa7, 0xb0, 0x69, 0xa6, 0x97, 0x4d, 0x36, 0xcb, 0x4b,
+  0x13, 0xd4, 0x67, 0xa4, 0xb9, 0xb9, 0xb7, 0xdf, 0xa3, 0x82, 0xd5, 0xd2, 0xf2, 0x90, 0xff, 0x6a,
+  0xa7, 0xc8, 0x7e, 0x43, 0x7e, 0xee, 0x37, 0xd3, 0xe9, 0xcf, 0xe3, 0xb1, 0x1e, 0x2d, 0x25, 0xfb,
+  0xa7, 0x60, 0xf8, 0x6f, 0xb5, 0x50, 0xfd, 0xe6, 0x96, 0x25, 0xe8, 0x81, 0x46, 0xf3, 0x92, 0xb5,
+  0x4f, 0x90, 0xfc, 0x86, 0xf0, 0x9f, 0x64, 0xaa, 0xd5, 0x96, 0x82, 0xf1, 0xfa, 0x3a, 0x0c, 0x8e,
+  0xa6, 0x8f, 0x18, 0xb6, 0x5f, 0x2a, 0xbe, 0x29, 0x57, 0x47, 0x1b, 0x65, 0xd8, 0x61, 0x31, 0xca,
+  0x9f,
+};
@@ -0,0 +1,139 @@
+// Host tests for the compressed OTA container parser: pio test -e native
+#include <string.h>
+#include <unity.h>
+#include <vector>
+#include "ota_fixture.h"
+#include "ota_stream.h"
+
+// Must match raw_image() in make_fixture.py.
+static std::vector<uint8_t> makeRawImage() {
+  static const char kText[] = "railroad lantern motion fade zone ";
+  const size_t textLen = sizeof(kText) - 1;
+  std::vector<uint8_t> raw(OTA_FIXTURE_RAW_SIZE);
+  uint32_t x = 12345;
+  for (size_t i = 0; i < raw.size(); i++) {
+    x = x * 1103515245u + 12345u;
+    raw[i] = i % 64 < 40 ? (uint8_t)kText[i % textLen] : (uint8_t)((x >> 16) & 0xFF);
+  }
+  return raw;
+}
+
+class MemorySink : public OtaSink {
+ public:
+  bool begin(const OtaImageHeader& header) override {
+    // A resume calls begin() again; keep what earlier blocks wrote.
+    image.resize(header.rawSize);
+    return true;
+  }
+  bool write(uint32_t offset, const uint8_t* data, size_t len) override {
+    if (offset + len > image.size()) return false;
+    memcpy(image.data() + offset, data, len);
+    return true;
+  }
+  bool blockDone(uint32_t block, uint32_t streamOffset) override {
+    nextBlock = block;
+    nextStreamOffset = streamOffset;
+    blocksDone++;
+    return true;
+  }
+
+  std::vector<uint8_t> image;
+  uint32_t nextBlock = 0;
+  uint32_t nextStreamOffset = 0;
+  uint32_t blocksDone = 0;
+};
+
+// Feeds [from, to) in uneven chunks, the way TCP delivers it.
+static OtaStreamResult feedRange(OtaStreamParser& parser, const uint8_t* data, size_t from, size_t to) {
+  static const size_t kChunks[] = {1, 7, 64, 333, 1024, 3};
+  OtaStreamResult result = OtaStreamResult::NeedMore;
+  size_t pos = from;
+  for (size_t i = 0; pos < to && result == OtaStreamResult::NeedMore; i++) {
+    size_t len = kChunks[i % (sizeof(kChunks) / sizeof(kChunks[0]))];
+    if (len > to - pos) len = to - pos;
+    result = parser.feed(data + pos, len);
+    pos += len;
+  }
+  return result;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_clean_decode() {
+  OtaImageHeader header;
+  TEST_ASSERT_TRUE(parseOtaHeader(kPackedImage, sizeof(kPackedImage), header));
+  TEST_ASSERT_EQUAL_UINT32(OTA_FIXTURE_RAW_SIZE, header.rawSize);
+
+  MemorySink sink;
+  OtaStreamParser parser(sink);
+  parser.begin();
+  TEST_ASSERT_EQUAL(OtaStreamResult::Done, feedRange(parser, kPackedImage, 0, sizeof(kPackedImage)));
+  TEST_ASSERT_EQUAL_UINT32(header.blockCount, sink.blocksDone);
+
+  std::vector<uint8_t> raw = makeRawImage();
+  TEST_ASSERT_EQUAL_MEMORY(raw.data(), sink.image.data(), raw.size());
+}
+
+static void test_resume_after_drop() {
+  OtaImageHeader header;
+  TEST_ASSERT_TRUE(parseOtaHeader(kPackedImage, sizeof(kPackedImage), header));
+
+  // The connection drops halfway through the container.
+  MemorySink sink;
+  OtaStreamParser first(sink);
+  first.begin();
+  TEST_ASSERT_EQUAL(OtaStreamResult::NeedMore, feedRange(first, kPackedImage, 0, sizeof(kPackedImage) / 2));
+  TEST_ASSERT_TRUE(sink.nextBlock > 0);
+  TEST_ASSERT_TRUE(sink.nextBlock < header.blockCount);
+
+  // A fresh parser (after a reboot) continues where blockDone() left off.
+  OtaStreamParser second(sink);
+  TEST_ASSERT_TRUE(second.resume(header, sink.nextBlock, sink.nextStreamOffset));
+  TEST_ASSERT_EQUAL(OtaStreamResult::Done,
+                    feedRange(second, kPackedImage, sink.nextStreamOffset, sizeof(kPackedImage)));
+
+  std::vector<uint8_t> raw = makeRawImage();
+  TEST_ASSERT_EQUAL_MEMORY(raw.data(), sink.image.data(), raw.size());
+}
+
+static void test_corrupted_block_fails_crc() {
+  std::vector<uint8_t> packed(kPackedImage, kPackedImage + sizeof(kPackedImage));
+  // Flip one bit inside the compressed data of the second block.
+  uint32_t firstBlockSize = packed[OTA_HEADER_SIZE] | (packed[OTA_HEADER_SIZE + 1] << 8) |
+                            (packed[OTA_HEADER_SIZE + 2] << 16) | ((uint32_t)packed[OTA_HEADER_SIZE + 3] << 24);
+  size_t secondBlock = OTA_HEADER_SIZE + OTA_BLOCK_HEADER_SIZE + firstBlockSize;
+  packed[secondBlock + OTA_BLOCK_HEADER_SIZE + 100] ^= 0x10;
+
+  MemorySink sink;
+  OtaStreamParser parser(sink);
+  parser.begin();
+  TEST_ASSERT_EQUAL(OtaStreamResult::Error, feedRange(parser, packed.data(), 0, packed.size()));
+  TEST_ASSERT_EQUAL_STRING("block_crc", parser.error());
+  // Only the intact first block was confirmed.
+  TEST_ASSERT_EQUAL_UINT32(1, sink.blocksDone);
+}
+
+static void test_signed_header_round_trip() {
+  OtaImageHeader header;
+  TEST_ASSERT_TRUE(parseOtaHeader(kPackedImage, sizeof(kPackedImage), header));
+  // The device re-encodes the header to check the signature against it.
+  uint8_t encoded[OTA_SIGNED_HEADER_SIZE];
+  encodeOtaSignedHeader(header, encoded);
+  TEST_ASSERT_EQUAL_MEMORY(kPackedImage, encoded, OTA_SIGNED_HEADER_SIZE);
+  TEST_ASSERT_EQUAL_MEMORY(kPackedImage + OTA_SIGNED_HEADER_SIZE, header.signature, OTA_SIGNATURE_SIZE);
+
+  // A set reserved field would not survive that, so it is refused.
+  std::vector<uint8_t> packed(kPackedImage, kPackedImage + OTA_HEADER_SIZE);
+  packed[18] = 1;
+  TEST_ASSERT_FALSE(parseOtaHeader(packed.data(), packed.size(), header));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_clean_decode);
+  RUN_TEST(test_resume_after_drop);
+  RUN_TEST(test_corrupted_block_fails_crc);
+  RUN_TEST(test_signed_header_round_trip);
+  return UNITY_END();
+}
@@ -0,0 +1,147 @@
+// Host tests for the peer packet codec and PeerFilter: pio test -e native
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <chrono>
+#include <unity.h>
+#include "peer_protocol.h"
+
+static PeerPacket motion(uint32_t deviceId, uint32_t bootId, uint16_t seq) {
+  PeerPacket packet = {PeerPacketType::Motion, deviceId, bootId, 0, seq, 1000};
+  return packet;
+}
+
+void setUp() {}
+void tearDown() {}
+
+static void test_round_trip() {
+  PeerPacket in = {PeerPacketType::Probe, 0xA1B2C3D4, 0x01020304, 3, 65535, 123456789};
+  uint8_t buffer[PEER_PACKET_SIZE];
+  TEST_ASSERT_TRUE(encodePeerPacket(in, buffer, sizeof(buffer)));
+
+  PeerPacket out;
+  TEST_ASSERT_TRUE(decodePeerPacket(buffer, sizeof(buffer), out));
+  TEST_ASSERT_EQUAL(PeerPacketType::Probe, out.type);
+  TEST_ASSERT_EQUAL_UINT32(0xA1B2C3D4, out.deviceId);
+  TEST_ASSERT_EQUAL_UINT32(0x01020304, out.bootId);
+  TEST_ASSERT_EQUAL_UINT8(3, out.zone);
+  TEST_ASSERT_EQUAL_UINT16(65535, out.seq);
+  TEST_ASSERT_EQUAL_UINT32(123456789, out.timestampMs);
+}
+
+static void test_rejects_foreign_packets() {
+  uint8_t buffer[PEER_PACKET_SIZE];
+  TEST_ASSERT_TRUE(encodePeerPacket(motion(1, 1, 1), buffer, sizeof(buffer)));
+  PeerPacket out;
+  TEST_ASSERT_FALSE(decodePeerPacket(buffer, PEER_PACKET_SIZE - 1, out));
+
+  buffer[2] = PEER_PROTOCOL_VERSION + 1;
+  TEST_ASSERT_FALSE(decodePeerPacket(buffer, sizeof(buffer), out));
+  buffer[2] = PEER_PROTOCOL_VERSION;
+  buffer[3] = 0;
+  TEST_ASSERT_FALSE(decodePeerPacket(buffer, sizeof(buffer), out));
+  buffer[3] = (uint8_t)PeerPacketType::Motion;
+  buffer[0] = 'X';
+  TEST_ASSERT_FALSE(decodePeerPacket(buffer, sizeof(buffer), out));
+  TEST_ASSERT_FALSE(encodePeerPacket(motion(1, 1, 1), buffer, PEER_PACKET_SIZE - 1));
+}
+
+static void test_filter_drops_duplicates_and_rate_limits() {
+  PeerFilter filter(500);
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(1, 7, 10), 1000));
+  TEST_ASSERT_EQUAL(PeerVerdict::Duplicate, filter.check(motion(1, 7, 10), 1001));
+  TEST_ASSERT_EQUAL(PeerVerdict::RateLimited, filter.check(motion(1, 7, 11), 1100));
+  TEST_ASSERT_EQUAL(PeerVerdict::Duplicate, filter.check(motion(1, 7, 11), 1101));
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(1, 7, 12), 1600));
+  // Other sources have their own state.
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(2, 7, 1), 1600));
+}
+
+static void test_filter_accepts_rebooted_peer() {
+  PeerFilter filter(500);
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(1, 7, 12), 1000));
+  // Same device, new boot: seq starts again at 0 and must not look like a repeat.
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(1, 8, 0), 5000));
+  TEST_ASSERT_EQUAL(PeerVerdict::Duplicate, filter.check(motion(1, 8, 0), 5001));
+}
+
+static void test_filter_replaces_least_recent_source() {
+  PeerFilter filter(500);
+  for (uint32_t device = 1; device <= PEER_FILTER_SLOTS; device++) {
+    TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(device, 1, 5), 1000 + device));
+  }
+  // A new source evicts device 1; device 1 is then unknown again.
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(100, 1, 5), 2000));
+  TEST_ASSERT_EQUAL(PeerVerdict::Accept, filter.check(motion(1, 1, 5), 2001));
+}
+
+static uint64_t nowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Sends every packet twice over a real loopback socket, like broadcastMotion().
+static void test_loopback_socket() {
+  int rx = socket(AF_INET, SOCK_DGRAM, 0);
+  int tx = socket(AF_INET, SOCK_DGRAM, 0);
+  TEST_ASSERT_TRUE(rx >= 0 && tx >= 0);
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  TEST_ASSERT_EQUAL(0, bind(rx, (sockaddr*)&addr, sizeof(addr)));
+  socklen_t addrLen = sizeof(addr);
+  TEST_ASSERT_EQUAL(0, getsockname(rx, (sockaddr*)&addr, &addrLen));
+  timeval timeout = {1, 0};
+  setsockopt(rx, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  PeerFilter filter(500);
+  int accepted = 0;
+  int duplicates = 0;
+  uint64_t maxLatencyUs = 0;
+  for (uint16_t seq = 0; seq < 20; seq++) {
+    uint32_t nowMs = 1000 + seq * 600;
+    uint8_t buffer[PEER_PACKET_SIZE];
+    TEST_ASSERT_TRUE(encodePeerPacket(motion(0x1234, 42, seq), buffer, sizeof(buffer)));
+    uint64_t sentUs = nowUs();
+    for (int copy = 0; copy < 2; copy++) {
+      TEST_ASSERT_EQUAL(PEER_PACKET_SIZE, sendto(tx, buffer, sizeof(buffer), 0, (sockaddr*)&addr, sizeof(addr)));
+    }
+    for (int copy = 0; copy < 2; copy++) {
+      uint8_t received[64];
+      ssize_t len = recv(rx, received, sizeof(received), 0);
+      TEST_ASSERT_EQUAL(PEER_PACKET_SIZE, len);
+      PeerPacket packet;
+      TEST_ASSERT_TRUE(decodePeerPacket(received, len, packet));
+      TEST_ASSERT_EQUAL_UINT16(seq, packet.seq);
+      PeerVerdict verdict = filter.check(packet, nowMs);
+      if (verdict == PeerVerdict::Accept) {
+        accepted++;
+        uint64_t latencyUs = nowUs() - sentUs;
+        if (latencyUs > maxLatencyUs) maxLatencyUs = latencyUs;
+      } else if (verdict == PeerVerdict::Duplicate) {
+        duplicates++;
+      }
+    }
+  }
+  close(rx);
+  close(tx);
+
+  TEST_ASSERT_EQUAL(20, accepted);
+  TEST_ASSERT_EQUAL(20, duplicates);
+  TEST_ASSERT_TRUE(maxLatencyUs < 20000);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_round_trip);
+  RUN_TEST(test_rejects_foreign_packets);
+  RUN_TEST(test_filter_drops_duplicates_and_rate_limits);
+  RUN_TEST(test_filter_accepts_rebooted_peer);
+  RUN_TEST(test_filter_replaces_least_recent_source);
+  RUN_TEST(test_loopback_socket);
+  return UNITY_END();
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Decode raillamp CBOR telemetry (built with -DTELEMETRY_CBOR=1) to JSON.
+
+Usage:
+  decode_telemetry.py status|event [HEX ...]
+
+Without HEX arguments, one hex payload per line is read from stdin, e.g.
+  mosquitto_sub -t 'raillamp/+/status/#' -F '%x' | decode_telemetry.py status
+
+Integer keys follow StatusKey / EventKey in src/telemetry.h.
+"""
+
+import json
+import struct
+import sys
+
+KEYS = {
+    "status": {1: "lightsOn", 2: "brightness", 3: "motion"},
+    "event": {1: "event", 2: "zone", 3: "lights_on", 4: "brightness", 5: "motion", 6: "message"},
+}
+
+
+class Decoder:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def byte(self):
+        if self.pos >= len(self.data):
+            raise ValueError("truncated payload")
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def argument(self, info):
+        if info < 24:
+            return info
+        sizes = {24: 1, 25: 2, 26: 4, 27: 8}
+        if info not in sizes:
+            raise ValueError("unsupported length %d" % info)
+        value = 0
+        for _ in range(sizes[info]):
+            value = (value << 8) | self.byte()
+        return value
+
+    def item(self):
+        initial = self.byte()
+        major, info = initial >> 5, initial & 0x1F
+        if major == 7:
+            if info == 20:
+                return False
+            if info == 21:
+                return True
+            if info == 22:
+                return None
+            if info == 26:
+                raw = bytes(self.byte() for _ in range(4))
+                return struct.unpack(">f", raw)[0]
+            raise ValueError("unsupported simple value %d" % info)
+        value = self.argument(info)
+        if major == 0:
+            return value
+        if major == 1:
+            return -1 - value
+        if major in (2, 3):
+            raw = bytes(self.byte() for _ in range(value))
+            return raw.decode("utf-8", "replace") if major == 3 else raw.hex()
+        if major == 4:
+            return [self.item() for _ in range(value)]
+        if major == 5:
+            return {self.item(): self.item() for _ in range(value)}
+        raise ValueError("unsupported major type %d" % major)
+
+
+def decode(kind, payload):
+    value = Decoder(payload).item()
+    if isinstance(value, dict):
+        names = KEYS[kind]
+        value = {names.get(k, k): v for k, v in value.items()}
+    return value
+
+
+def main(argv):
+    if len(argv) < 2 or argv[1] not in KEYS:
+        sys.stderr.write(__doc__)
+        return 2
+    kind = argv[1]
+    lines = argv[2:] or (line.strip() for line in sys.stdin)
+    for line in lines:
+        if not line:
+            continue
+        payload = bytes.fromhex(line)
+        print(json.dumps(decode(kind, payload)), "(%d bytes)" % len(payload))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Pack a firmware .bin into the compressed, resumable OTA container.
+
+Usage:
+  pack_ota.py --key ota_signing.pem firmware.bin firmware.rlo [--block-size 16384] [-w 10] [-l 5]
+  pack_ota.py --key ota_signing.pem --print-pubkey
+
+The format is described in src/ota_stream.h. Each block is compressed on
+its own with heatshrink-compatible LZSS so the device can resume a broken
+download at any block boundary.
+
+The header is signed with an ECDSA P-256 key; the device only accepts
+containers that verify against the key built in as OTA_SIGNING_PUBKEY
+(--print-pubkey prints it). Create a key once with
+  openssl ecparam -name prime256v1 -genkey -noout -out ota_signing.pem
+and keep it out of the repository. Signing runs the openssl CLI.
+"""
+
+import argparse
+import hashlib
+import struct
+import subprocess
+import sys
+import zlib
+
+MIN_MATCH_KEY = 3
+MAX_CHAIN = 32
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.current = 0
+        self.bits = 0
+
+    def write(self, value, count):
+        for shift in range(count - 1, -1, -1):
+            self.current = (self.current << 1) | ((value >> shift) & 1)
+            self.bits += 1
+            if self.bits == 8:
+                self.out.append(self.current)
+                self.current = 0
+                self.bits = 0
+
+    def finish(self):
+        if self.bits:
+            self.out.append(self.current << (8 - self.bits))
+            self.current = 0
+            self.bits = 0
+        return bytes(self.out)
+
+
+def compress(data, window_bits, lookahead_bits):
+    window = 1 << window_bits
+    max_len = 1 << lookahead_bits
+    backref_bits = 1 + window_bits + lookahead_bits
+    writer = BitWriter()
+    chains = {}
+    pos = 0
+    n = len(data)
+
+    def remember(i):
+        if i + MIN_MATCH_KEY <= n:
+            chains.setdefault(data[i:i + MIN_MATCH_KEY], []).append(i)
+
+    while pos < n:
+        best_len = 0
+        best_dist = 0
+        candidates = chains.get(data[pos:pos + MIN_MATCH_KEY], ())
+        limit = min(max_len, n - pos)
+        for start in reversed(candidates[-MAX_CHAIN:]):
+            dist = pos - start
+            if dist > window:
+                break
+            length = 0
+            while length < limit and data[start + length] == data[pos + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_dist = length, dist
+                if length == limit:
+                    break
+
+        if best_len * 9 > backref_bits:
+            writer.write(0, 1)
+            writer.write(best_dist - 1, window_bits)
+            writer.write(best_len - 1, lookahead_bits)
+            for i in range(pos, pos + best_len):
+                remember(i)
+            pos += best_len
+        else:
+            writer.write(1, 1)
+            writer.write(data[pos], 8)
+            remember(pos)
+            pos += 1
+    return writer.finish()
+
+
+def public_key(key_path):
+    """Uncompressed P-256 point (65 bytes) of the private key in key_path."""
+    der = subprocess.run(["openssl", "ec", "-in", key_path, "-pubout", "-outform", "DER"],
+                         stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, check=True).stdout
+    # SubjectPublicKeyInfo of a P-256 key: 26 bytes of algorithm ids, then the point.
+    if len(der) != 91 or der[26] != 4:
+        raise ValueError("%s is not a P-256 key" % key_path)
+    return der[26:]
+
+
+def read_der_int(der, pos):
+    if der[pos] != 0x02:
+        raise ValueError("bad DER signature")
+    length = der[pos + 1]
+    value = int.from_bytes(der[pos + 2:pos + 2 + length], "big")
+    return value, pos + 2 + length
+
+
+def sign(key_path, data):
+    """ECDSA P-256 over SHA-256(data), as 64 bytes r || s."""
+    der = subprocess.run(["openssl", "dgst", "-sha256", "-sign", key_path], input=data,
+                         stdout=subprocess.PIPE, check=True).stdout
+    if der[0] != 0x30:
+        raise ValueError("bad DER signature")
+    r, pos = read_der_int(der, 2)
+    s, _ = read_der_int(der, pos)
+    return r.to_bytes(32, "big") + s.to_bytes(32, "big")
+
+
+def pack(raw, block_size, window_bits, lookahead_bits, key_path):
+    block_count = (len(raw) + block_size - 1) // block_size
+    out = bytearray()
+    out += b"RLO2"
+    out += struct.pack("<IIIBBH", len(raw), block_size, block_count, window_bits, lookahead_bits, 0)
+    out += hashlib.sha256(raw).digest()
+    out += sign(key_path, bytes(out))
+    for i in range(block_count):
+        block = raw[i * block_size:(i + 1) * block_size]
+        compressed = compress(block, window_bits, lookahead_bits)
+        out += struct.pack("<II", len(compressed), zlib.crc32(block) & 0xFFFFFFFF)
+        out += compressed
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?")
+    parser.add_argument("output", nargs="?")
+    parser.add_argument("--key", required=True, help="ECDSA P-256 private key (PEM)")
+    parser.add_argument("--print-pubkey", action="store_true",
+                        help="print the public key as hex for -DOTA_SIGNING_PUBKEY and exit")
+    parser.add_argument("--block-size", type=int, default=16384)
+    parser.add_argument("-w", "--window-bits", type=int, default=10)
+    parser.add_argument("-l", "--lookahead-bits", type=int, default=5)
+    args = parser.parse_args()
+
+    if args.print_pubkey:
+        print(public_key(args.key).hex())
+        return 0
+    if not args.input or not args.output:
+        parser.error("input and output are required")
+
+    if args.block_size % 4096:
+        parser.error("block size must be a multiple of the 4096 byte flash sector")
+    if not 4 <= args.window_bits <= 11:
+        parser.error("window bits must be 4..11 (device buffer limit)")
+    if not 3 <= args.lookahead_bits < args.window_bits:
+        parser.error("lookahead bits must be 3..window_bits-1")
+
+    with open(args.input, "rb") as f:
+        raw = f.read()
+    packed = pack(raw, args.block_size, args.window_bits, args.lookahead_bits, args.key)
+    with open(args.output, "wb") as f:
+        f.write(packed)
+    print("%s: %d -> %d bytes (%.1f%%)" % (args.output, len(raw), len(packed), 100.0 * len(packed) / max(1, len(raw))))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())